@@ -0,0 +1,235 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_ASYNC_LIFT_HPP
+#define UREACT_ADAPTOR_ASYNC_LIFT_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/async_dispatcher.hpp>
+#include <ureact/utility/signal_pack.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+/// Input node receiving results of asynchronous computation
+template <typename S>
+class async_lift_output_node final : public signal_node<S>
+{
+public:
+    template <typename T>
+    async_lift_output_node(
+        const context& context, T&& value, std::shared_ptr<node_base> request_node )
+        : async_lift_output_node::signal_node( context, std::forward<T>( value ) )
+        , m_request_node( std::move( request_node ) )
+    {}
+
+    void set_result( S&& value )
+    {
+        m_new_value = std::move( value );
+        this->get_graph().push_input( this->get_node_id() );
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        if( !m_new_value.has_value() )
+            return update_result::unchanged;
+
+        const update_result result = this->try_change_value( std::move( *m_new_value ) );
+        m_new_value.reset();
+        return result;
+    }
+
+private:
+    // Requests are sent while the output is alive
+    std::shared_ptr<node_base> m_request_node;
+
+    std::optional<S> m_new_value;
+};
+
+/// Node sending snapshots of dependency values to the executor when they change
+template <typename S, typename F, typename... Values>
+class async_lift_request_node final : public node_base
+{
+public:
+    template <typename InF>
+    async_lift_request_node( const context& context,
+        const signal_pack<Values...>& deps,
+        InF&& func,
+        const async_dispatcher& dispatcher )
+        : async_lift_request_node::node_base( context )
+        , m_deps( deps.data )
+        , m_state( std::make_shared<state>( std::forward<InF>( func ) ) )
+        , m_dispatcher( dispatcher )
+    {
+        this->attach_to( m_deps );
+    }
+
+    ~async_lift_request_node() override
+    {
+        this->detach_from_all();
+    }
+
+    void set_output( std::weak_ptr<async_lift_output_node<S>> output )
+    {
+        m_output = std::move( output );
+    }
+
+    // Initial value is calculated synchronously
+    UREACT_WARN_UNUSED_RESULT S evaluate()
+    {
+        UREACT_CALLBACK_GUARD( this->get_graph() );
+        return std::apply( m_state->func, snapshot() );
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        // Newer request supersedes all pending ones
+        const std::uint64_t generation = ++m_state->generation;
+
+        UREACT_CALLBACK_GUARD( this->get_graph() );
+        m_dispatcher.submit( [state = m_state,
+                                 completed = m_dispatcher.get_completion_queue(),
+                                 output = m_output,
+                                 generation,
+                                 args = snapshot()]() {
+            // Superseded before it has started
+            if( state->generation != generation )
+                return;
+
+            completed->push( [state,
+                                 output,
+                                 generation,
+                                 result = std::apply( state->func, args )]() mutable {
+                // Superseded while it was running
+                if( state->generation != generation )
+                    return false;
+
+                const std::shared_ptr<async_lift_output_node<S>> output_node = output.lock();
+                if( !output_node )
+                    return false;
+
+                output_node->set_result( std::move( result ) );
+                return true;
+            } );
+        } );
+
+        return update_result::unchanged;
+    }
+
+private:
+    // Shared with the jobs, so it outlives the node if needed
+    struct state
+    {
+        template <typename InF>
+        explicit state( InF&& func )
+            : func( std::forward<InF>( func ) )
+        {}
+
+        F func;
+        std::atomic<std::uint64_t> generation{ 0 };
+    };
+
+    UREACT_WARN_UNUSED_RESULT std::tuple<Values...> snapshot() const
+    {
+        return std::apply(
+            []( const signal<Values>&... args ) {
+                return std::tuple<Values...>{ get_internals( args ).value_ref()... };
+            },
+            m_deps );
+    }
+
+    std::tuple<signal<Values>...> m_deps;
+    std::shared_ptr<state> m_state;
+    async_dispatcher m_dispatcher;
+    std::weak_ptr<async_lift_output_node<S>> m_output;
+};
+
+struct AsyncLiftAdaptor : Adaptor
+{
+    /*!
+	 * @brief Create a new signal with value v = std::invoke(func, arg_pack.get(), ...)
+	 *        calculated asynchronously
+	 *
+	 *  Initial value is calculated synchronously. When any of args changes, copies of their
+	 *  values are passed to func on the executor of dispatcher, and the signal keeps its last
+	 *  value until the result is published by dispatcher.process_completed() in a later turn.
+	 *  A newer change supersedes pending computations: the ones that haven't started are
+	 *  skipped, and results of the ones that are already running are dropped.
+	 *
+	 *  Func can be called on several threads simultaneously and should not throw.
+	 */
+    template <typename... Values, typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()( const signal_pack<Values...>& arg_pack,
+        const async_dispatcher& dispatcher,
+        InF&& func ) const
+    {
+        using F = std::decay_t<InF>;
+        using S = std::decay_t<std::invoke_result_t<F&, const Values&...>>;
+        using RequestNode = async_lift_request_node<S, F, Values...>;
+        using OutputNode = async_lift_output_node<S>;
+
+        const context& context = std::get<0>( arg_pack.data ).get_context();
+        assert( context == dispatcher.get_context() && "Dispatcher of another context" );
+
+        const std::shared_ptr<RequestNode> request_node
+            = create_node<RequestNode>( context, arg_pack, std::forward<InF>( func ), dispatcher );
+
+        auto result = create_wrapped_node<signal<S>, OutputNode>(
+            context, request_node->evaluate(), request_node );
+
+        request_node->set_output(
+            std::static_pointer_cast<OutputNode>( get_internals( result ).get_node_ptr() ) );
+
+        return result;
+    }
+
+    /*!
+	 * @brief Create a new signal with value v = std::invoke(func, arg.get())
+	 *        calculated asynchronously
+	 */
+    template <typename Value, typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()(
+        const signal<Value>& arg, const async_dispatcher& dispatcher, InF&& func ) const
+    {
+        return operator()( with( arg ), dispatcher, std::forward<InF>( func ) );
+    }
+
+    /*!
+	 * @brief Curried version of async_lift(const signal_pack<Values...>& arg_pack,
+	 *        const async_dispatcher& dispatcher, InF&& func)
+	 */
+    template <typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()(
+        const async_dispatcher& dispatcher, InF&& func ) const
+    {
+        return make_partial<AsyncLiftAdaptor>( dispatcher, std::forward<InF>( func ) );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create a new signal applying function to given signals on a worker thread
+ */
+inline constexpr detail::AsyncLiftAdaptor async_lift;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_ASYNC_LIFT_HPP
@@ -0,0 +1,147 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_DETECT_CHANGES_HPP
+#define UREACT_ADAPTOR_DETECT_CHANGES_HPP
+
+#include <utility>
+
+#include <ureact/adaptor/lift.hpp>
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/detail/temp_signal.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/change_policy.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+struct identity_op
+{
+    template <typename T>
+    UREACT_WARN_UNUSED_RESULT const T& operator()( const T& value ) const noexcept
+    {
+        return value;
+    }
+};
+
+template <typename S, typename Op, typename Policy>
+class signal_policy_node final : public signal_node<S>
+{
+public:
+    template <typename InPolicy, typename... Args>
+    explicit signal_policy_node( const context& context, InPolicy&& policy, Args&&... args )
+        : signal_policy_node::signal_node( context )
+        , m_policy( std::forward<InPolicy>( policy ) )
+        , m_op( std::forward<Args>( args )... )
+    {
+        this->m_value = evaluate();
+
+        if( m_op.is_constant() )
+            this->mark_as_constant();
+        else
+            m_op.attach( *this );
+    }
+
+    ~signal_policy_node() override
+    {
+        m_op.detach( *this );
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        S new_value = evaluate();
+
+        bool changed;
+        {
+            UREACT_CALLBACK_GUARD( this->get_graph() );
+            changed = m_policy( std::as_const( this->m_value ), std::as_const( new_value ) );
+        }
+
+        if( changed )
+        {
+            this->assign_value( std::move( new_value ) );
+            return update_result::changed;
+        }
+        return update_result::unchanged;
+    }
+
+private:
+    auto evaluate()
+    {
+        UREACT_CALLBACK_GUARD( this->get_graph() );
+        return m_op.evaluate();
+    }
+
+    Policy m_policy;
+    Op m_op;
+};
+
+struct DetectChangesAdaptor : Adaptor
+{
+    /*!
+	 * @brief Create a signal following source that uses the given change detection policy
+	 *
+	 *  Policy replaces has_changed based change detection of the signal.
+	 *  See @ref change_policy for predefined policies.
+	 *
+	 *  The signature of policy should be equivalent to:
+	 *  * bool policy(const S& current_value, const S& new_value)
+	 */
+    template <typename S, typename InPolicy>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()(
+        const signal<S>& source, InPolicy&& policy ) const
+    {
+        using Policy = std::decay_t<InPolicy>;
+        using Op = function_op<S, identity_op, signal_node_ptr_t<S>>;
+        using Node = signal_policy_node<S, Op, Policy>;
+
+        return detail::create_wrapped_node<signal<S>, Node>( source.get_context(),
+            std::forward<InPolicy>( policy ),
+            identity_op{},
+            get_internals( source ).get_node_ptr() );
+    }
+
+    /*!
+	 * @brief Create a signal following source that uses the given change detection policy
+	 *
+	 *  Operator of temp_signal is stolen, so no additional node is created.
+	 */
+    template <typename S, typename OpIn, typename InPolicy>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()(
+        temp_signal<S, OpIn>&& source, InPolicy&& policy ) const
+    {
+        using Policy = std::decay_t<InPolicy>;
+        using Node = signal_policy_node<S, OpIn, Policy>;
+
+        const context& context = source.get_context();
+        return detail::create_wrapped_node<signal<S>, Node>(
+            context, std::forward<InPolicy>( policy ), std::move( source ).steal_op() );
+    }
+
+    /*!
+	 * @brief Curried version of detect_changes()
+	 */
+    template <typename InPolicy>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()( InPolicy&& policy ) const
+    {
+        return make_partial<DetectChangesAdaptor>( std::forward<InPolicy>( policy ) );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create a signal following source that uses the given change detection policy
+ */
+inline constexpr detail::DetectChangesAdaptor detect_changes;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_DETECT_CHANGES_HPP
@@ -116,6 +116,8 @@ public:
         }
         else if constexpr( std::is_invocable_r_v<void, F, event_range<E>, S&, Deps...> )
         {
+            this->save_previous_value();
+
             std::apply(
                 [this, &src_events]( const signal<Deps>&... args ) {
                     UREACT_CALLBACK_GUARD( this->get_graph() );
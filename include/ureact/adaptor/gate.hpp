@@ -0,0 +1,100 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_GATE_HPP
+#define UREACT_ADAPTOR_GATE_HPP
+
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/signal.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+template <typename S>
+class signal_gate_node final : public signal_node<S>
+{
+public:
+    signal_gate_node( const context& context,
+        std::shared_ptr<signal_node<S>> source,
+        std::shared_ptr<signal_node<bool>> active )
+        : signal_gate_node::signal_node( context, source->value_ref() )
+        , m_source( std::move( source ) )
+        , m_active( std::move( active ) )
+    {
+        this->attach_to( m_source->get_node_id() );
+        this->attach_to( m_active->get_node_id() );
+    }
+
+    ~signal_gate_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        if( !m_active->value_ref() )
+        {
+            // Value becomes stale, successors are not notified until the gate is opened
+            return update_result::unchanged;
+        }
+
+        // Either source has changed or the gate has been reopened,
+        // in both cases the value is refreshed once
+        return this->try_change_value( m_source->value_ref() );
+    }
+
+private:
+    std::shared_ptr<signal_node<S>> m_source;
+    std::shared_ptr<signal_node<bool>> m_active;
+};
+
+struct GateAdaptor : Adaptor
+{
+    /*!
+	 * @brief Suspend propagation of a signal and everything that depends on it
+	 *
+	 *  Creates a signal following the value of source while active is true.
+	 *  While active is false, the value is frozen and changes of source are not propagated,
+	 *  so all nodes depending on the result are not updated at all.
+	 *  The value is refreshed once when active becomes true again.
+	 *
+	 *  Place gate at the entry of a subgraph that is irrelevant while inactive
+	 *  (e.g. a hidden UI panel) to stop spending CPU on it without destroying its observers.
+	 */
+    template <typename S>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()(
+        const signal<S>& source, const signal<bool>& active ) const
+    {
+        const context& context = source.get_context();
+        return detail::create_wrapped_node<signal<S>, signal_gate_node<S>>(
+            context,
+            get_internals( source ).get_node_ptr(),
+            get_internals( active ).get_node_ptr() );
+    }
+
+    /*!
+	 * @brief Curried version of gate()
+	 */
+    UREACT_WARN_UNUSED_RESULT auto operator()( const signal<bool>& active ) const
+    {
+        return make_partial<GateAdaptor>( active );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Suspend propagation of a signal and everything that depends on it
+ */
+inline constexpr detail::GateAdaptor gate;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_GATE_HPP
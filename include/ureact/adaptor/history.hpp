@@ -0,0 +1,95 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_HISTORY_HPP
+#define UREACT_ADAPTOR_HISTORY_HPP
+
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/history_window.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+template <typename S, size_t N>
+class signal_history_node final : public signal_node<history_window<S, N>>
+{
+public:
+    signal_history_node( const context& context, const signal<S>& source )
+        : signal_history_node::signal_node( context )
+        , m_source( source )
+    {
+        this->m_value.push( get_internals( m_source ).value_ref() );
+
+        if( node_base::are_all_constant( m_source ) )
+            this->mark_as_constant();
+        else
+            this->attach_to( m_source );
+    }
+
+    ~signal_history_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        this->save_previous_value();
+
+        // Window is modified in place, so no allocations happen during propagation
+        this->m_value.push( get_internals( m_source ).value_ref() );
+
+        return update_result::changed;
+    }
+
+private:
+    signal<S> m_source;
+};
+
+template <size_t N>
+struct HistoryClosure : AdaptorClosure
+{
+    static_assert( N >= 1 );
+
+    template <typename S>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()( const signal<S>& source ) const
+    {
+        using node_type = signal_history_node<S, N>;
+
+        const context& context = source.get_context();
+        return detail::create_wrapped_node<signal<history_window<S, N>>, node_type>(
+            context, source );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Takes a signal<S> and keeps a window of its last N values
+ *
+ *  The result is signal<history_window<S, N>> holding the values from the oldest
+ *  to the newest one, including the current value of source. The window is stored
+ *  inline in the node and is contiguous in memory, so rates, slopes or moving statistics
+ *  can be calculated with lift over the result without copying values into event buffers.
+ *
+ * Example of history<3>:
+ *  src = 1 2 3 4 5
+ *  s0  = [1]
+ *  s1  = [1 2]
+ *  s2  = [1 2 3]
+ *  s3  =   [2 3 4]
+ *  s4  =     [3 4 5]
+ */
+template <size_t N>
+inline constexpr detail::HistoryClosure<N> history;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_HISTORY_HPP
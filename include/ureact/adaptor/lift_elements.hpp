@@ -0,0 +1,150 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_LIFT_ELEMENTS_HPP
+#define UREACT_ADAPTOR_LIFT_ELEMENTS_HPP
+
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/detail/has_changed.hpp>
+#include <ureact/signal_array.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+template <typename S, typename T, typename F>
+class signal_array_lift_node final : public signal_array_node<S>
+{
+public:
+    template <typename InF>
+    signal_array_lift_node( const context& context, const signal_array<T>& source, InF&& func )
+        : signal_array_lift_node::signal_array_node(
+            context, evaluate_all( context, source, func ) )
+        , m_source( source )
+        , m_func( std::forward<InF>( func ) )
+    {
+        if( node_base::are_all_constant( m_source ) )
+            this->mark_as_constant();
+        else
+            this->attach_to( m_source );
+    }
+
+    ~signal_array_lift_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        const auto& source_node = *get_internals( m_source ).get_node_ptr();
+        const std::vector<T>& source_values = source_node.values_ref();
+        const std::vector<size_t>& dirty = source_node.dirty_indices();
+
+        UREACT_CALLBACK_GUARD( this->get_graph() );
+
+        // Recalculating the whole array in a single tight loop is cheaper than
+        // random access via dirty indices when a noticeable part of elements has changed
+        if( dirty.size() > source_values.size() / dense_threshold )
+        {
+            m_scratch.resize( source_values.size() );
+            for( size_t i = 0, n = source_values.size(); i < n; ++i )
+                m_scratch[i] = std::invoke( m_func, source_values[i] );
+
+            for( size_t i = 0, n = m_scratch.size(); i < n; ++i )
+            {
+                const S& old_value = this->m_values[i];
+                const S& new_value = m_scratch[i];
+                if( has_changed( old_value, new_value ) )
+                    this->mark_dirty( i );
+            }
+
+            this->m_values.swap( m_scratch );
+        }
+        else
+        {
+            for( const size_t index : dirty )
+                this->try_change_element( index, std::invoke( m_func, source_values[index] ) );
+        }
+
+        return this->dirty_result();
+    }
+
+private:
+    /// The whole array is recalculated if more than 1/dense_threshold of elements are dirty
+    static constexpr size_t dense_threshold = 8;
+
+    template <typename InF>
+    UREACT_WARN_UNUSED_RESULT static std::vector<S> evaluate_all(
+        context context, const signal_array<T>& source, InF& func )
+    {
+        UREACT_CALLBACK_GUARD( get_internals( context ).get_graph() );
+
+        const std::vector<T>& source_values = get_internals( source ).get_node_ptr()->values_ref();
+
+        std::vector<S> result;
+        result.reserve( source_values.size() );
+        for( const T& value : source_values )
+            result.push_back( std::invoke( func, value ) );
+        return result;
+    }
+
+    signal_array<T> m_source;
+    F m_func;
+    std::vector<S> m_scratch;
+};
+
+struct LiftElementsAdaptor : Adaptor
+{
+    /*!
+	 * @brief Create a new signal array applying func to each element of source
+	 *
+	 *  The signature of func should be equivalent to:
+	 *  * S func(const T&)
+	 *
+	 *  The result is a single node, so the whole array is updated by a single kernel call
+	 *  instead of scheduling a node per element. Only dirty elements of source are
+	 *  recalculated, unless a noticeable part of them has changed. In the latter case
+	 *  the whole array is recalculated in a single contiguous pass.
+	 *  Only elements which values have changed are marked dirty in the result.
+	 */
+    template <typename T, typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()( const signal_array<T>& source, InF&& func ) const
+    {
+        using F = std::decay_t<InF>;
+        using S = std::decay_t<std::invoke_result_t<F&, const T&>>;
+        using Node = signal_array_lift_node<S, T, F>;
+
+        return create_wrapped_node<signal_array<S>, Node>(
+            source.get_context(), source, std::forward<InF>( func ) );
+    }
+
+    /*!
+	 * @brief Curried version of lift_elements(const signal_array<T>& source, F&& func)
+	 */
+    template <typename InF>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()( InF&& func ) const
+    {
+        return make_partial<LiftElementsAdaptor>( std::forward<InF>( func ) );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create a new signal array applying func to each element of source
+ */
+inline constexpr detail::LiftElementsAdaptor lift_elements;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_LIFT_ELEMENTS_HPP
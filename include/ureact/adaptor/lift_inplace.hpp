@@ -0,0 +1,149 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_LIFT_INPLACE_HPP
+#define UREACT_ADAPTOR_LIFT_INPLACE_HPP
+
+#include <functional>
+
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/signal_pack.hpp>
+#include <ureact/utility/type_traits.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+template <typename S, typename F, typename... Values>
+class signal_lift_inplace_node final : public signal_node<S>
+{
+public:
+    template <typename InS, typename InF>
+    signal_lift_inplace_node(
+        const context& context, InS&& init, const signal_pack<Values...>& deps, InF&& func )
+        : signal_lift_inplace_node::signal_node( context, std::forward<InS>( init ) )
+        , m_deps( deps )
+        , m_func( std::forward<InF>( func ) )
+    {
+        // Initial value is calculated regardless of reported change
+        (void)evaluate();
+
+        const bool is_constant = std::apply(
+            []( const auto&... deps ) { //
+                return node_base::are_all_constant( deps... );
+            },
+            m_deps.data );
+        if( is_constant )
+            this->mark_as_constant();
+        else
+            this->attach_to( m_deps.data );
+    }
+
+    ~signal_lift_inplace_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        this->save_previous_value();
+
+        return evaluate() ? update_result::changed : update_result::unchanged;
+    }
+
+private:
+    UREACT_WARN_UNUSED_RESULT bool evaluate()
+    {
+        return std::apply(
+            [this]( const signal<Values>&... args ) {
+                UREACT_CALLBACK_GUARD( this->get_graph() );
+                if constexpr( std::is_invocable_r_v<bool, F&, S&, const Values&...> )
+                {
+                    return static_cast<bool>( std::invoke(
+                        m_func, this->m_value, get_internals( args ).value_ref()... ) );
+                }
+                else
+                {
+                    std::invoke( m_func, this->m_value, get_internals( args ).value_ref()... );
+
+                    // Always assume change
+                    return true;
+                }
+            },
+            m_deps.data );
+    }
+
+    signal_pack<Values...> m_deps;
+    F m_func;
+};
+
+struct LiftInplaceAdaptor : Adaptor
+{
+    /*!
+	 * @brief Create a new signal node which value is updated in-place by func
+	 *
+	 *  The signature of func should be equivalent to:
+	 *  * bool func(S& out, const Values& ...)
+	 *  * void func(S& out, const Values& ...)
+	 *
+	 *  Creates a signal with an initial value v = init, then func(v, arg_pack.get()...)
+	 *  is called on construction and when any of args have changed.
+	 *  Func rewrites the value in place, so capacity of containers is reused between updates
+	 *  and no new value is allocated. It returns if the value was changed. If the return type
+	 *  of func is void, the value is always assumed changed.
+	 */
+    template <typename... Values, typename V, typename InF>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()(
+        const signal_pack<Values...>& arg_pack, V&& init, InF&& func ) const
+    {
+        using F = std::decay_t<InF>;
+        using S = std::decay_t<V>;
+        using Node = signal_lift_inplace_node<S, F, Values...>;
+
+        static_assert( std::is_invocable_r_v<void, F&, S&, const Values&...>,
+            "lift_inplace: Passed function does not match any of the supported signatures" );
+
+        const context& context = std::get<0>( arg_pack.data ).get_context();
+        return detail::create_wrapped_node<signal<S>, Node>(
+            context, std::forward<V>( init ), arg_pack, std::forward<InF>( func ) );
+    }
+
+    /*!
+	 * @brief Create a new signal node which value is updated in-place by func
+	 */
+    template <typename Value, typename V, typename InF>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()(
+        const signal<Value>& arg, V&& init, InF&& func ) const
+    {
+        return operator()(
+            signal_pack<Value>{ arg }, std::forward<V>( init ), std::forward<InF>( func ) );
+    }
+
+    /*!
+	 * @brief Curried version of lift_inplace()
+	 */
+    template <typename V, typename InF>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()( V&& init, InF&& func ) const
+    {
+        return make_partial<LiftInplaceAdaptor>(
+            std::forward<V>( init ), std::forward<InF>( func ) );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create a new signal node which value is updated in-place by func
+ */
+inline constexpr detail::LiftInplaceAdaptor lift_inplace;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_LIFT_INPLACE_HPP
@@ -0,0 +1,128 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_LIFT_MEMO_HPP
+#define UREACT_ADAPTOR_LIFT_MEMO_HPP
+
+#include <ureact/adaptor/lift.hpp>
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/memoize.hpp>
+#include <ureact/utility/signal_pack.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+template <typename SIn = void>
+struct LiftMemoAdaptor : Adaptor
+{
+    /*!
+	 * @brief Create a new signal node with value v = std::invoke(func, arg_pack.get(), ...)
+	 *        caching results of func
+	 *
+	 *  Func is required to be pure. Results are cached in a direct-mapped cache of the given
+	 *  capacity, see @ref memoized. Values of arg_pack should be equality comparable.
+	 *
+	 *  The signature of hasher should be equivalent to:
+	 *  * size_t hasher(const Values& ...)
+	 *
+	 *  @note To inspect hit/miss counters, create the function with @ref memoize
+	 *        and pass it to lift directly
+	 */
+    template <typename... Values, typename InF, typename InHasher>
+    UREACT_WARN_UNUSED_RESULT auto operator()( const signal_pack<Values...>& arg_pack,
+        InF&& func,
+        const size_t capacity,
+        InHasher&& hasher ) const
+    {
+        return LiftAdaptor<SIn>{}( arg_pack,
+            memoize<Values...>(
+                std::forward<InF>( func ), capacity, std::forward<InHasher>( hasher ) ) );
+    }
+
+    /*!
+	 * @brief Create a new signal node with value v = std::invoke(func, arg_pack.get(), ...)
+	 *        caching results of func using @ref memo_hash
+	 */
+    template <typename... Values, typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()( const signal_pack<Values...>& arg_pack,
+        InF&& func,
+        const size_t capacity = 16 ) const
+    {
+        return operator()( arg_pack, std::forward<InF>( func ), capacity, memo_hash{} );
+    }
+
+    /*!
+	 * @brief Create a new signal node with value v = std::invoke(func, arg.get())
+	 *        caching results of func
+	 */
+    template <typename Value, typename InF, typename InHasher>
+    UREACT_WARN_UNUSED_RESULT auto operator()( const signal<Value>& arg,
+        InF&& func,
+        const size_t capacity,
+        InHasher&& hasher ) const
+    {
+        return operator()(
+            with( arg ), std::forward<InF>( func ), capacity, std::forward<InHasher>( hasher ) );
+    }
+
+    /*!
+	 * @brief Create a new signal node with value v = std::invoke(func, arg.get())
+	 *        caching results of func using @ref memo_hash
+	 */
+    template <typename Value, typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()(
+        const signal<Value>& arg, InF&& func, const size_t capacity = 16 ) const
+    {
+        return operator()( with( arg ), std::forward<InF>( func ), capacity, memo_hash{} );
+    }
+
+    /*!
+	 * @brief Curried version of lift_memo(const signal_pack<Values...>& arg_pack, InF&& func,
+	 *        size_t capacity)
+	 */
+    template <typename InF>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()(
+        InF&& func, const size_t capacity = 16 ) const
+    {
+        return make_partial<LiftMemoAdaptor>( std::forward<InF>( func ), capacity );
+    }
+
+    /*!
+	 * @brief Curried version of lift_memo(const signal_pack<Values...>& arg_pack, InF&& func,
+	 *        size_t capacity, InHasher&& hasher)
+	 */
+    template <typename InF, typename InHasher>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()(
+        InF&& func, const size_t capacity, InHasher&& hasher ) const
+    {
+        return make_partial<LiftMemoAdaptor>(
+            std::forward<InF>( func ), capacity, std::forward<InHasher>( hasher ) );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create a new signal applying pure function to given signals and caching its results
+ *
+ *  Type of resulting signal should be explicitly specified.
+ */
+template <typename SIn = void>
+inline constexpr detail::LiftMemoAdaptor<SIn> lift_memo_as;
+
+/*!
+ * @brief Create a new signal applying pure function to given signals and caching its results
+ */
+inline constexpr detail::LiftMemoAdaptor<> lift_memo;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_LIFT_MEMO_HPP
@@ -0,0 +1,181 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_LIFT_MULTI_HPP
+#define UREACT_ADAPTOR_LIFT_MULTI_HPP
+
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/signal_pack.hpp>
+#include <ureact/utility/type_traits.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+/// Node evaluating the function once per turn and holding its results for output nodes
+template <typename Results, typename F, typename... Values>
+class lift_multi_node final : public node_base
+{
+public:
+    template <typename InF>
+    lift_multi_node( const context& context, const signal_pack<Values...>& deps, InF&& func )
+        : lift_multi_node::node_base( context )
+        , m_deps( deps.data )
+        , m_func( std::forward<InF>( func ) )
+        , m_results( evaluate() )
+    {
+        const bool is_constant = std::apply(
+            []( const auto&... args ) { return are_all_constant( args... ); }, m_deps );
+
+        if( is_constant )
+            this->mark_as_constant();
+        else
+            this->attach_to( m_deps );
+    }
+
+    ~lift_multi_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        m_results = evaluate();
+
+        // Output nodes compare their own values
+        return update_result::changed;
+    }
+
+    // Result is moved out by the only output node that owns it
+    template <size_t I>
+    UREACT_WARN_UNUSED_RESULT auto&& take_result()
+    {
+        return std::move( std::get<I>( m_results ) );
+    }
+
+private:
+    UREACT_WARN_UNUSED_RESULT Results evaluate()
+    {
+        return std::apply(
+            [this]( const signal<Values>&... args ) {
+                UREACT_CALLBACK_GUARD( this->get_graph() );
+                return std::invoke( m_func, get_internals( args ).value_ref()... );
+            },
+            m_deps );
+    }
+
+    std::tuple<signal<Values>...> m_deps;
+    F m_func;
+    Results m_results;
+};
+
+template <typename S, typename Core, size_t I>
+class lift_multi_output_node final : public signal_node<S>
+{
+public:
+    lift_multi_output_node( const context& context, const std::shared_ptr<Core>& core )
+        : lift_multi_output_node::signal_node( context, core->template take_result<I>() )
+        , m_core( core )
+    {
+        if( m_core->is_constant() )
+            this->mark_as_constant();
+        else
+            this->attach_to( m_core->get_node_id() );
+    }
+
+    ~lift_multi_output_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        return this->try_change_value( m_core->template take_result<I>() );
+    }
+
+private:
+    std::shared_ptr<Core> m_core;
+};
+
+struct LiftMultiAdaptor : Adaptor
+{
+    /*!
+	 * @brief Create signals for elements of the result of std::invoke(func, arg_pack.get(), ...)
+	 *
+	 *  The signature of func should be equivalent to:
+	 *  * std::tuple<Ts...> func(const Values& ...)
+	 *  Any tuple-like type such as std::pair or std::array can be returned as well.
+	 *
+	 *  Returns std::tuple<signal<Ts>...>. Func is evaluated once per turn when any of args
+	 *  has changed. Each output signal has its own change detection, so only consumers
+	 *  of actually changed outputs are updated.
+	 */
+    template <typename... Values, typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()(
+        const signal_pack<Values...>& arg_pack, InF&& func ) const
+    {
+        using F = std::decay_t<InF>;
+        using Results = std::decay_t<std::invoke_result_t<F&, const Values&...>>;
+        using Core = lift_multi_node<Results, F, Values...>;
+
+        const context& context = std::get<0>( arg_pack.data ).get_context();
+
+        const std::shared_ptr<Core> core
+            = create_node<Core>( context, arg_pack, std::forward<InF>( func ) );
+
+        return make_outputs<Results>(
+            context, core, std::make_index_sequence<std::tuple_size_v<Results>>() );
+    }
+
+    /*!
+	 * @brief Create signals for each element of the result of std::invoke(func, arg.get())
+	 */
+    template <typename Value, typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()( const signal<Value>& arg, InF&& func ) const
+    {
+        return operator()( with( arg ), std::forward<InF>( func ) );
+    }
+
+    /*!
+	 * @brief Curried version of lift_multi(const signal_pack<Values...>& arg_pack, InF&& func)
+	 */
+    template <typename InF>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()( InF&& func ) const
+    {
+        return make_partial<LiftMultiAdaptor>( std::forward<InF>( func ) );
+    }
+
+private:
+    template <typename Results, typename Core, size_t... Is>
+    UREACT_WARN_UNUSED_RESULT static auto make_outputs(
+        const context& context, const std::shared_ptr<Core>& core, std::index_sequence<Is...> )
+    {
+        return std::make_tuple(
+            create_wrapped_node<signal<std::tuple_element_t<Is, Results>>,
+                lift_multi_output_node<std::tuple_element_t<Is, Results>, Core, Is>>(
+                context, core )... );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create several signals from a single evaluation of the function
+ */
+inline constexpr detail::LiftMultiAdaptor lift_multi;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_LIFT_MULTI_HPP
@@ -0,0 +1,150 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_LIFT_SHARED_HPP
+#define UREACT_ADAPTOR_LIFT_SHARED_HPP
+
+#include <cstdint>
+#include <tuple>
+#include <typeinfo>
+#include <vector>
+
+#include <ureact/adaptor/lift.hpp>
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/detail/deduce_result_type.hpp>
+#include <ureact/detail/shared_node_table.hpp>
+#include <ureact/detail/temp_signal.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/signal_pack.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+/// Identity of the function. Nodes with equal function identities calculate the same value
+template <typename F>
+UREACT_WARN_UNUSED_RESULT std::uintptr_t shared_function_id( [[maybe_unused]] const F& func )
+{
+    if constexpr( std::is_pointer_v<F> && std::is_function_v<std::remove_pointer_t<F>> )
+    {
+        return reinterpret_cast<std::uintptr_t>( func );
+    }
+    else
+    {
+        static_assert( std::is_empty_v<F>,
+            "lift_shared: function should be either a stateless functor or a function pointer" );
+
+        // Stateless functor is identified by its type, which is a part of the node type
+        return 0;
+    }
+}
+
+template <typename SIn = void>
+struct LiftSharedAdaptor : Adaptor
+{
+    /*!
+	 * @brief Create or reuse a signal node with value v = std::invoke(func, arg_pack.get(), ...)
+	 *
+	 *  Nodes are interned by the function identity and dependency nodes, so structurally
+	 *  identical expressions created with lift_shared share a single node that is evaluated
+	 *  once per turn. The shared node lives while any of the returned signals is alive.
+	 *
+	 *  Function is required to be pure. It should be either a stateless functor such as
+	 *  std::plus<> or a captureless lambda (identified by type), or a function pointer
+	 *  (identified by type and address).
+	 */
+    template <typename... Values, typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()(
+        const signal_pack<Values...>& arg_pack, InF&& func ) const
+    {
+        using F = std::decay_t<InF>;
+        using S = deduce_result_type<SIn, F, Values...>;
+        using Op = function_op<S, F, signal_node_ptr_t<Values>...>;
+        using Node = signal_op_node<S, Op>;
+
+        context context = std::get<0>( arg_pack.data ).get_context();
+        shared_node_table& shared_nodes
+            = get_shared_node_table( get_internals( context ).get_graph() );
+
+        shared_node_key key{ typeid( Node ),
+            shared_function_id( func ),
+            std::apply(
+                []( const signal<Values>&... args ) {
+                    return std::vector<node_id>{ get_internals( args ).get_node_id()... };
+                },
+                arg_pack.data ) };
+
+        signal<S> result;
+        if( auto node = shared_nodes.find( key ) )
+        {
+            get_internals( result ).get_node_ptr() = std::static_pointer_cast<Node>( node );
+        }
+        else
+        {
+            auto new_node = std::apply(
+                [&context, &func]( const signal<Values>&... args ) {
+                    return create_node<Node>( context,
+                        std::forward<InF>( func ),
+                        get_internals( args ).get_node_ptr()... );
+                },
+                arg_pack.data );
+
+            shared_nodes.insert( std::move( key ), new_node );
+            get_internals( result ).get_node_ptr() = std::move( new_node );
+        }
+        return result;
+    }
+
+    /*!
+	 * @brief Create or reuse a signal node with value v = std::invoke(func, arg.get())
+	 */
+    template <typename Value, typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()( const signal<Value>& arg, InF&& func ) const
+    {
+        return operator()( with( arg ), std::forward<InF>( func ) );
+    }
+
+    /*!
+	 * @brief Create or reuse a signal node with value v = std::invoke(func, lhs.get(), rhs.get())
+	 */
+    template <typename LeftVal, typename InF, typename RightVal>
+    UREACT_WARN_UNUSED_RESULT auto operator()(
+        const signal<LeftVal>& lhs, InF&& func, const signal<RightVal>& rhs ) const
+    {
+        return operator()( with( lhs, rhs ), std::forward<InF>( func ) );
+    }
+
+    /*!
+	 * @brief Curried version of lift_shared(const signal_pack<Values...>& arg_pack, InF&& func)
+	 */
+    template <typename InF>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()( InF&& func ) const
+    {
+        return make_partial<LiftSharedAdaptor>( std::forward<InF>( func ) );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create or reuse a signal applying pure function to given signals
+ *
+ *  Type of resulting signal should be explicitly specified.
+ */
+template <typename SIn = void>
+inline constexpr detail::LiftSharedAdaptor<SIn> lift_shared_as;
+
+/*!
+ * @brief Create or reuse a signal applying pure function to given signals
+ */
+inline constexpr detail::LiftSharedAdaptor<> lift_shared;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_LIFT_SHARED_HPP
@@ -26,7 +26,11 @@ public:
         : event_merge_node::event_stream_node( context )
         , m_sources( sources... )
     {
+        // Constant sources never emit, so they are not attached to at all
         this->attach_to( sources... );
+
+        if( this->are_all_constant( sources... ) )
+            this->mark_as_constant();
     }
 
     ~event_merge_node() override
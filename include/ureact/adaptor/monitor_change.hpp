@@ -10,34 +10,65 @@
 #ifndef UREACT_ADAPTOR_MONITOR_CHANGE_HPP
 #define UREACT_ADAPTOR_MONITOR_CHANGE_HPP
 
-#include <ureact/adaptor/monitor.hpp>
-#include <ureact/adaptor/transform.hpp>
+#include <utility>
+
 #include <ureact/detail/adaptor.hpp>
+#include <ureact/events.hpp>
+#include <ureact/signal.hpp>
 
 UREACT_BEGIN_NAMESPACE
 
 namespace detail
 {
 
+template <typename S>
+class monitor_change_node final : public event_stream_node<std::pair<S, S>>
+{
+public:
+    monitor_change_node( const context& context, const signal<S>& target )
+        : monitor_change_node::event_stream_node( context )
+        , m_target( target )
+    {
+        get_internals( m_target ).get_node_ptr()->keep_previous_value();
+
+        this->attach_to( m_target );
+    }
+
+    ~monitor_change_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        const auto& target_node = get_internals( m_target ).get_node_ptr();
+        this->get_events().emplace_back(
+            target_node->previous_value_ref(), target_node->value_ref() );
+
+        return update_result::changed;
+    }
+
+private:
+    signal<S> m_target;
+};
+
 struct MonitorChangeClosure : AdaptorClosure
 {
     /*!
 	 * @brief Emits pairs of value changes of signal as events
 	 *
 	 *  When target changes, emit the new value 'e = std::pair(old_value, target.get())'.
+	 *
+	 *  The old value is kept by the target node itself, so the only copies made are
+	 *  the ones stored in the emitted pair.
 	 */
     template <typename S>
     UREACT_WARN_UNUSED_RESULT constexpr auto operator()( const signal<S>& target ) const
+        -> events<std::pair<S, S>>
     {
-        return target //
-             | monitor
-             | transform(
-                 [memento = get_internals( target ).value_ref()]( const S& new_value ) mutable //
-                 {
-                     S old_value = memento;
-                     memento = new_value;
-                     return std::make_pair( std::move( old_value ), new_value );
-                 } );
+        const context& context = target.get_context();
+        return detail::create_wrapped_node<events<std::pair<S, S>>, monitor_change_node<S>>(
+            context, target );
     }
 };
 
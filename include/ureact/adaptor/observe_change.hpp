@@ -0,0 +1,133 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_OBSERVE_CHANGE_HPP
+#define UREACT_ADAPTOR_OBSERVE_CHANGE_HPP
+
+#include <ureact/adaptor/observe.hpp>
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/detail/observer_node.hpp>
+#include <ureact/observer.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/observer_action.hpp>
+#include <ureact/utility/type_traits.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+template <typename S, typename F>
+class signal_change_observer_node final : public observer_node
+{
+public:
+    template <typename InF>
+    signal_change_observer_node( const context& context, const signal<S>& subject, InF&& func )
+        : signal_change_observer_node::observer_node( context )
+        , m_subject( subject )
+        , m_func( std::forward<InF>( func ) )
+    {
+        get_internals( m_subject ).get_node_ptr()->keep_previous_value();
+
+        this->attach_to( m_subject );
+    }
+
+    ~signal_change_observer_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        if( m_subject.is_valid() )
+        {
+            const auto& subject_node = get_internals( m_subject ).get_node_ptr();
+
+            const observer_action action = std::invoke(
+                m_func, subject_node->previous_value_ref(), subject_node->value_ref() );
+
+            if( action == observer_action::stop_and_detach )
+                detach_observer();
+        }
+
+        return update_result::unchanged;
+    }
+
+private:
+    void detach_observer() override
+    {
+        detach_from_all();
+
+        m_subject = signal<S>{};
+    }
+
+    signal<S> m_subject;
+    F m_func;
+};
+
+struct ObserveChangeAdaptor : Adaptor
+{
+    /*!
+	 * @brief Create observer for signal receiving both old and new values
+	 *
+	 *  When the signal value S of subject changes, func is called with the value before
+	 *  the change and the current value.
+	 *
+	 *  The signature of func should be equivalent to:
+	 *  * void func(const S& old_value, const S& new_value)
+	 *  * observer_action func(const S& old_value, const S& new_value)
+	 *
+	 *  Subject keeps its previous value in a second buffer that is swapped with the current one
+	 *  on change, so no copies of S are made and no intermediate nodes are created.
+	 *  Only values modified in place are copied before modification.
+	 */
+    template <typename InF, typename S>
+    UREACT_WARN_UNUSED_RESULT auto operator()( const signal<S>& subject, InF&& func ) const
+        -> observer
+    {
+        using F = std::decay_t<InF>;
+
+        // clang-format off
+        using wrapper_t =
+            select_t<
+                // observer_action func(const S&, const S&)
+                condition<std::is_invocable_r_v<observer_action, F, const S&, const S&>,
+                          F>,
+                // void func(const S&, const S&)
+                condition<std::is_invocable_r_v<void, F, const S&, const S&>,
+                          add_observer_action_next_ret<F>>,
+                signature_mismatches>;
+        // clang-format on
+
+        static_assert( !std::is_same_v<wrapper_t, signature_mismatches>,
+            "observe_change: Passed function does not match any of the supported signatures" );
+
+        return create_wrapped_node<observer, signal_change_observer_node<S, wrapper_t>>(
+            subject.get_context(), subject, std::forward<InF>( func ) );
+    }
+
+    /*!
+	 * @brief Curried version of observe_change(const signal<S>& subject, F&& func)
+	 */
+    template <typename F>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()( F&& func ) const
+    {
+        return make_partial<ObserveChangeAdaptor>( std::forward<F>( func ) );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create observer for signal receiving both old and new values
+ */
+inline constexpr detail::ObserveChangeAdaptor observe_change;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_OBSERVE_CHANGE_HPP
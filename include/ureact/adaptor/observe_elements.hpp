@@ -0,0 +1,133 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_OBSERVE_ELEMENTS_HPP
+#define UREACT_ADAPTOR_OBSERVE_ELEMENTS_HPP
+
+#include <ureact/adaptor/observe.hpp>
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/detail/observer_node.hpp>
+#include <ureact/observer.hpp>
+#include <ureact/signal_array.hpp>
+#include <ureact/utility/observer_action.hpp>
+#include <ureact/utility/type_traits.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+template <typename T, typename F>
+class signal_array_observer_node final : public observer_node
+{
+public:
+    template <typename InF>
+    signal_array_observer_node(
+        const context& context, const signal_array<T>& subject, InF&& func )
+        : signal_array_observer_node::observer_node( context )
+        , m_subject( subject )
+        , m_func( std::forward<InF>( func ) )
+    {
+        this->attach_to( m_subject );
+    }
+
+    ~signal_array_observer_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        if( m_subject.is_valid() )
+        {
+            const auto& subject_node = *get_internals( m_subject ).get_node_ptr();
+            const std::vector<T>& values = subject_node.values_ref();
+
+            for( const size_t index : subject_node.dirty_indices() )
+            {
+                const observer_action action = std::invoke( m_func, index, values[index] );
+
+                if( action == observer_action::stop_and_detach )
+                {
+                    detach_observer();
+                    break;
+                }
+            }
+        }
+
+        return update_result::unchanged;
+    }
+
+private:
+    void detach_observer() override
+    {
+        detach_from_all();
+
+        m_subject = signal_array<T>{};
+    }
+
+    signal_array<T> m_subject;
+    F m_func;
+};
+
+struct ObserveElementsAdaptor : Adaptor
+{
+    /*!
+	 * @brief Create observer for signal array called for each changed element
+	 *
+	 *  func is called only for elements changed in the current turn, in order of change.
+	 *
+	 *  The signature of func should be equivalent to:
+	 *  * void func(size_t index, const T& value)
+	 *  * observer_action func(size_t index, const T& value)
+	 */
+    template <typename T, typename InF>
+    UREACT_WARN_UNUSED_RESULT auto operator()(
+        const signal_array<T>& subject, InF&& func ) const -> observer
+    {
+        using F = std::decay_t<InF>;
+
+        // clang-format off
+        using wrapper_t =
+            select_t<
+                // observer_action func(size_t, const T&)
+                condition<std::is_invocable_r_v<observer_action, F, size_t, const T&>,
+                          F>,
+                // void func(size_t, const T&)
+                condition<std::is_invocable_r_v<void, F, size_t, const T&>,
+                          add_observer_action_next_ret<F>>,
+                signature_mismatches>;
+        // clang-format on
+
+        static_assert( !std::is_same_v<wrapper_t, signature_mismatches>,
+            "observe_elements: Passed function does not match any of the supported signatures" );
+
+        return create_wrapped_node<observer, signal_array_observer_node<T, wrapper_t>>(
+            subject.get_context(), subject, std::forward<InF>( func ) );
+    }
+
+    /*!
+	 * @brief Curried version of observe_elements(const signal_array<T>& subject, F&& func)
+	 */
+    template <typename F>
+    UREACT_WARN_UNUSED_RESULT constexpr auto operator()( F&& func ) const
+    {
+        return make_partial<ObserveElementsAdaptor>( std::forward<F>( func ) );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create observer for signal array called for each changed element
+ */
+inline constexpr detail::ObserveElementsAdaptor observe_elements;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_OBSERVE_ELEMENTS_HPP
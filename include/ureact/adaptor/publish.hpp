@@ -0,0 +1,133 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_PUBLISH_HPP
+#define UREACT_ADAPTOR_PUBLISH_HPP
+
+#include <memory>
+#include <tuple>
+
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/detail/observer_node.hpp>
+#include <ureact/observer.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/signal_pack.hpp>
+#include <ureact/utility/snapshot_reader.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+template <typename... Values>
+class publish_node final : public observer_node
+{
+public:
+    publish_node( const context& context,
+        const signal_pack<Values...>& deps,
+        std::shared_ptr<snapshot_buffer<Values...>> buffer )
+        : publish_node::observer_node( context )
+        , m_deps( deps )
+        , m_buffer( std::move( buffer ) )
+    {
+        publish();
+
+        this->attach_to( m_deps.data );
+    }
+
+    ~publish_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        // Observers are updated after all their dependencies, so values are final for the turn
+        if( m_buffer )
+            publish();
+
+        return update_result::unchanged;
+    }
+
+private:
+    void publish()
+    {
+        std::apply(
+            [this]( const signal<Values>&... deps ) {
+                m_buffer->publish( get_internals( deps ).value_ref()... );
+            },
+            m_deps.data );
+    }
+
+    void detach_observer() override
+    {
+        detach_from_all();
+
+        m_buffer.reset();
+    }
+
+    signal_pack<Values...> m_deps;
+    std::shared_ptr<snapshot_buffer<Values...>> m_buffer;
+};
+
+struct PublishAdaptor : Adaptor
+{
+    /*!
+	 * @brief Publish values of signals for reading from other threads
+	 *
+	 *  Current values are published immediately, and then after each turn where
+	 *  any of the signals has changed. Values are read via reader from any thread,
+	 *  consistently as of the same turn, without locks.
+	 *
+	 *  If readers hold all slots of the reader, one more slot is allocated,
+	 *  see @ref snapshot_reader.
+	 *
+	 *  Publishing stops when the returned observer is destroyed or detached.
+	 */
+    template <typename... Values>
+    UREACT_WARN_UNUSED_RESULT auto operator()(
+        const signal_pack<Values...>& deps, const snapshot_reader<Values...>& reader ) const
+        -> observer
+    {
+        static_assert( sizeof...( Values ) >= 1, "publish: 1+ signals are required" );
+
+        const context& context = std::get<0>( deps.data ).get_context();
+        return create_wrapped_node<observer, publish_node<Values...>>(
+            context, deps, reader.get_buffer() );
+    }
+
+    /*!
+	 * @brief Publish value of signal for reading from other threads
+	 */
+    template <typename S>
+    UREACT_WARN_UNUSED_RESULT auto operator()(
+        const signal<S>& subject, const snapshot_reader<S>& reader ) const -> observer
+    {
+        return operator()( signal_pack<S>{ subject }, reader );
+    }
+
+    /*!
+	 * @brief Curried version of publish(const signal_pack<Values...>& deps, reader)
+	 */
+    template <typename... Values>
+    UREACT_WARN_UNUSED_RESULT auto operator()( const snapshot_reader<Values...>& reader ) const
+    {
+        return make_partial<PublishAdaptor>( reader );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Publish values of signals for reading from other threads
+ */
+inline constexpr detail::PublishAdaptor publish;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_PUBLISH_HPP
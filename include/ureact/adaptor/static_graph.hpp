@@ -0,0 +1,345 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_STATIC_GRAPH_HPP
+#define UREACT_ADAPTOR_STATIC_GRAPH_HPP
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/detail/has_changed.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/signal_pack.hpp>
+#include <ureact/utility/type_traits.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+/*!
+ * @brief Node of a @ref static_graph
+ *
+ *  Deps are indices of slots the node depends on. Slots [0, N) are inputs of the static graph,
+ *  slots [N, N + M) are its nodes in order of declaration.
+ */
+template <typename F, size_t... Deps>
+struct static_graph_node
+{
+    F func;
+};
+
+/*!
+ * @brief Create a node of a @ref static_graph with value v = std::invoke(func, slot<Deps>...)
+ */
+template <size_t... Deps, typename InF>
+UREACT_WARN_UNUSED_RESULT constexpr auto static_node( InF&& func )
+{
+    return static_graph_node<std::decay_t<InF>, Deps...>{ std::forward<InF>( func ) };
+}
+
+namespace detail
+{
+
+/// Calculate value types of all slots: inputs followed by node results
+template <typename Slots, typename... Nodes>
+struct static_graph_slots;
+
+template <typename... Slots>
+struct static_graph_slots<std::tuple<Slots...>>
+{
+    using type = std::tuple<Slots...>;
+};
+
+template <typename... Slots, typename F, size_t... Deps, typename... Nodes>
+struct static_graph_slots<std::tuple<Slots...>, static_graph_node<F, Deps...>, Nodes...>
+{
+    static_assert( ( ( Deps < sizeof...( Slots ) ) && ... ),
+        "static_graph: node can depend only on inputs and preceding nodes" );
+
+    using value_t = std::decay_t<
+        std::invoke_result_t<F&, const std::tuple_element_t<Deps, std::tuple<Slots...>>&...>>;
+
+    using type = typename static_graph_slots<std::tuple<Slots..., value_t>, Nodes...>::type;
+};
+
+template <typename T, size_t Offset, typename Indices>
+struct tuple_tail_impl;
+
+template <typename T, size_t Offset, size_t... Is>
+struct tuple_tail_impl<T, Offset, std::index_sequence<Is...>>
+{
+    using type = std::tuple<std::tuple_element_t<Offset + Is, T>...>;
+};
+
+/// Tuple of node result types without input types
+template <size_t InputCount, typename... Values, typename... Nodes>
+auto static_graph_result( std::tuple<Values...>*, std::tuple<Nodes...>* ) ->
+    typename tuple_tail_impl<typename static_graph_slots<std::tuple<Values...>, Nodes...>::type,
+        InputCount,
+        std::make_index_sequence<sizeof...( Nodes )>>::type;
+
+template <typename Results, typename Inputs, typename Nodes>
+class static_graph_node_impl;
+
+/*!
+ * @brief Single reactive node evaluating the whole static graph
+ *
+ *  Nodes are evaluated in the order of declaration, which is a topological order by construction.
+ *  A node is re-evaluated only if any of its dependencies is dirty, and it becomes dirty itself
+ *  only if its value has changed. Dirty flags live on the stack, so no heap allocations,
+ *  virtual calls or queue operations take place inside of the static graph.
+ */
+template <typename Results, typename... Values, typename... Nodes>
+class static_graph_node_impl<Results, std::tuple<Values...>, std::tuple<Nodes...>> final
+    : public node_base
+{
+    static constexpr size_t input_count = sizeof...( Values );
+    static constexpr size_t node_count = sizeof...( Nodes );
+
+    using dirty_flags = std::array<bool, input_count + node_count>;
+    using inputs_t = std::tuple<signal<Values>...>;
+
+public:
+    template <typename... InNodes>
+    static_graph_node_impl(
+        const context& context, const signal_pack<Values...>& inputs, InNodes&&... nodes )
+        : static_graph_node_impl::node_base( context )
+        , m_inputs( inputs.data )
+        , m_values( build_initial_value<0>( this->get_graph(),
+              inputs.data,
+              std::forward_as_tuple( nodes... ),
+              std::tuple<>{} ) )
+        , m_nodes( std::forward<InNodes>( nodes )... )
+    {
+        const bool is_constant = std::apply(
+            []( const auto&... args ) { return are_all_constant( args... ); }, m_inputs );
+
+        if( is_constant )
+            this->mark_as_constant();
+        else
+            this->attach_to( m_inputs );
+    }
+
+    ~static_graph_node_impl() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        // All inputs are considered dirty, because we are not notified which one has changed.
+        // Tracking it would require either a node per input or a copy of each input value
+        dirty_flags dirty{};
+        for( size_t i = 0; i < input_count; ++i )
+            dirty[i] = true;
+
+        m_changed.fill( false );
+
+        bool changed = false;
+        evaluate_nodes( dirty, changed, std::make_index_sequence<node_count>() );
+
+        return changed ? update_result::changed : update_result::unchanged;
+    }
+
+    template <size_t K>
+    UREACT_WARN_UNUSED_RESULT const auto& value_ref() const
+    {
+        return std::get<K>( m_values );
+    }
+
+    /// Return if the value of the node K has changed in the latest update
+    template <size_t K>
+    UREACT_WARN_UNUSED_RESULT bool is_changed() const
+    {
+        return m_changed[K];
+    }
+
+private:
+    template <size_t Slot, typename ResultsTuple>
+    UREACT_WARN_UNUSED_RESULT static decltype( auto ) get_slot(
+        const inputs_t& inputs, const ResultsTuple& results )
+    {
+        if constexpr( Slot < input_count )
+            return get_internals( std::get<Slot>( inputs ) ).value_ref();
+        else
+            return std::get<Slot - input_count>( results );
+    }
+
+    // Func is passed separately to keep its constness, so nodes passed by const reference
+    // can be used to calculate the initial value, while stored nodes are invoked as non-const
+    template <typename ResultsTuple, typename Func, typename F, size_t... Deps>
+    UREACT_WARN_UNUSED_RESULT static auto invoke_node( [[maybe_unused]] react_graph& graph,
+        const inputs_t& inputs,
+        const ResultsTuple& results,
+        Func& func,
+        const static_graph_node<F, Deps...>& )
+    {
+        UREACT_CALLBACK_GUARD( graph );
+        return std::invoke( func, get_slot<Deps>( inputs, results )... );
+    }
+
+    template <size_t K, typename NodeRefs, typename... Done>
+    UREACT_WARN_UNUSED_RESULT static Results build_initial_value( react_graph& graph,
+        const inputs_t& inputs,
+        const NodeRefs& nodes,
+        std::tuple<Done...>&& done )
+    {
+        if constexpr( K == node_count )
+        {
+            return std::move( done );
+        }
+        else
+        {
+            auto& node = std::get<K>( nodes );
+            auto value = invoke_node( graph, inputs, done, node.func, node );
+            return build_initial_value<K + 1>( graph,
+                inputs,
+                nodes,
+                std::tuple_cat( std::move( done ), std::make_tuple( std::move( value ) ) ) );
+        }
+    }
+
+    template <size_t... Deps, typename F>
+    UREACT_WARN_UNUSED_RESULT static bool is_any_dirty(
+        const dirty_flags& dirty, const static_graph_node<F, Deps...>& )
+    {
+        return ( dirty[Deps] || ... );
+    }
+
+    template <size_t K>
+    void evaluate_node( dirty_flags& dirty, bool& changed )
+    {
+        auto& node = std::get<K>( m_nodes );
+        if( !is_any_dirty( dirty, node ) )
+            return;
+
+        auto new_value = invoke_node( this->get_graph(), m_inputs, m_values, node.func, node );
+        auto& value = std::get<K>( m_values );
+        if( has_changed( value, new_value ) )
+        {
+            value = std::move( new_value );
+            dirty[input_count + K] = true;
+            m_changed[K] = true;
+            changed = true;
+        }
+    }
+
+    template <size_t... Ks>
+    void evaluate_nodes( dirty_flags& dirty, bool& changed, std::index_sequence<Ks...> )
+    {
+        ( evaluate_node<Ks>( dirty, changed ), ... );
+    }
+
+    inputs_t m_inputs;
+
+    // Initial values are calculated before nodes are moved into m_nodes
+    Results m_values;
+    std::tuple<Nodes...> m_nodes;
+    std::array<bool, node_count> m_changed{};
+};
+
+/// Output bridge of a single node of a static graph into the dynamic graph
+template <typename S, typename Core, size_t K>
+class static_graph_output_node final : public signal_node<S>
+{
+public:
+    static_graph_output_node( const context& context, const std::shared_ptr<Core>& core )
+        : static_graph_output_node::signal_node( context, core->template value_ref<K>() )
+        , m_core( core )
+    {
+        if( m_core->is_constant() )
+            this->mark_as_constant();
+        else
+            this->attach_to( m_core->get_node_id() );
+    }
+
+    ~static_graph_output_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        // Values are already compared inside of the static graph
+        if( !m_core->template is_changed<K>() )
+            return update_result::unchanged;
+
+        this->assign_value( m_core->template value_ref<K>() );
+        return update_result::changed;
+    }
+
+private:
+    std::shared_ptr<Core> m_core;
+};
+
+struct StaticGraphAdaptor : Adaptor
+{
+    /*!
+     * @brief Create signals for nodes of a graph with topology known at compile time
+     *
+     *  Each node is created with @ref static_node<Deps...>(func) and can depend on inputs
+     *  and on preceding nodes. Slots [0, N) are values of signals in inputs,
+     *  slots [N, N + M) are values of nodes in order of declaration.
+     *
+     *  The whole graph is evaluated by a single reactive node. Its propagation is a generated
+     *  sequence of function calls in precomputed order that skips nodes which dependencies
+     *  haven't changed.
+     *
+     *  Returns std::tuple<signal<Ts>...> with a signal for each node in order of declaration.
+     *  Each output signal changes only if the value of its node has changed, so only consumers
+     *  of actually changed nodes are updated.
+     *
+     *  The static graph is notified only that some of its inputs have changed, so all nodes
+     *  depending directly on inputs are re-evaluated on each change of any input.
+     *  Only nodes depending solely on unchanged node values are skipped.
+     */
+    template <typename... Values, typename... InNodes>
+    UREACT_WARN_UNUSED_RESULT auto operator()(
+        const signal_pack<Values...>& inputs, InNodes&&... nodes ) const
+    {
+        static_assert( sizeof...( Values ) >= 1, "static_graph: 1+ inputs are required" );
+        static_assert( sizeof...( InNodes ) >= 1, "static_graph: 1+ nodes are required" );
+
+        using nodes_t = std::tuple<std::decay_t<InNodes>...>;
+        using Results = decltype( static_graph_result<sizeof...( Values )>(
+            static_cast<std::tuple<Values...>*>( nullptr ), static_cast<nodes_t*>( nullptr ) ) );
+        using Core = static_graph_node_impl<Results, std::tuple<Values...>, nodes_t>;
+
+        const context& context = std::get<0>( inputs.data ).get_context();
+
+        const std::shared_ptr<Core> core
+            = create_node<Core>( context, inputs, std::forward<InNodes>( nodes )... );
+
+        return make_outputs<Results>(
+            context, core, std::make_index_sequence<sizeof...( InNodes )>() );
+    }
+
+private:
+    template <typename Results, typename Core, size_t... Ks>
+    UREACT_WARN_UNUSED_RESULT static auto make_outputs(
+        const context& context, const std::shared_ptr<Core>& core, std::index_sequence<Ks...> )
+    {
+        return std::make_tuple(
+            create_wrapped_node<signal<std::tuple_element_t<Ks, Results>>,
+                static_graph_output_node<std::tuple_element_t<Ks, Results>, Core, Ks>>(
+                context, core )... );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create signals for nodes of a graph with topology known at compile time
+ */
+inline constexpr detail::StaticGraphAdaptor static_graph;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_STATIC_GRAPH_HPP
@@ -0,0 +1,147 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_ADAPTOR_SWITCH_ON_HPP
+#define UREACT_ADAPTOR_SWITCH_ON_HPP
+
+#include <array>
+#include <memory>
+#include <type_traits>
+
+#include <ureact/detail/adaptor.hpp>
+#include <ureact/detail/slot_tap_node.hpp>
+#include <ureact/signal.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+template <typename I, typename S, size_t N>
+class signal_switch_node final
+    : public signal_node<S>
+    , public slot_tap_owner
+{
+public:
+    signal_switch_node(
+        const context& context, const signal<I>& index, const std::array<signal<S>, N>& candidates )
+        : signal_switch_node::signal_node(
+            context, get_internals( candidates[to_slot( index, 0 )] ).value_ref() )
+        , m_index( index )
+        , m_candidates( candidates )
+        , m_selected( to_slot( index, 0 ) )
+    {
+        const bool is_constant = node_base::are_all_constant( m_index )
+                              && all_candidates_are_constant();
+        if( is_constant )
+        {
+            this->mark_as_constant();
+        }
+        else
+        {
+            this->attach_to( m_index );
+            for( size_t slot = 0; slot < N; ++slot )
+            {
+                m_taps[slot] = create_node<slot_tap_node<S>>(
+                    context, *this, slot, m_candidates[slot] );
+                this->attach_to( m_taps[slot]->get_node_id() );
+            }
+        }
+    }
+
+    ~signal_switch_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        const size_t selected = to_slot( m_index, m_selected );
+        const bool is_selected_changed = m_candidate_changed[selected];
+        m_candidate_changed.fill( false );
+
+        // Changes of candidates other than the selected one are filtered out here
+        if( selected == m_selected && !is_selected_changed )
+            return update_result::unchanged;
+
+        m_selected = selected;
+        return this->try_change_value( get_internals( m_candidates[selected] ).value_ref() );
+    }
+
+    void mark_slot_changed( const size_t slot ) override
+    {
+        m_candidate_changed[slot] = true;
+    }
+
+private:
+    // Out of range index selects the fallback slot
+    UREACT_WARN_UNUSED_RESULT static size_t to_slot(
+        const signal<I>& index, const size_t fallback )
+    {
+        const auto i = static_cast<size_t>( get_internals( index ).value_ref() );
+        return i < N ? i : fallback;
+    }
+
+    UREACT_WARN_UNUSED_RESULT bool all_candidates_are_constant() const
+    {
+        for( const signal<S>& candidate : m_candidates )
+            if( !node_base::are_all_constant( candidate ) )
+                return false;
+        return true;
+    }
+
+    signal<I> m_index;
+    std::array<signal<S>, N> m_candidates;
+    std::array<std::shared_ptr<slot_tap_node<S>>, N> m_taps;
+    std::array<bool, N> m_candidate_changed{};
+    size_t m_selected;
+};
+
+struct SwitchOnAdaptor : Adaptor
+{
+    /*!
+	 * @brief Create a new signal with the value of the candidate selected by index
+	 *
+	 *  The value of index should be in range [0, N), where N is the number of candidates.
+	 *  If the index is out of range, the previously selected candidate stays selected.
+	 *  If the index is out of range on creation, the first candidate is selected.
+	 *
+	 *  Unlike @ref reactive_ref or @ref flatten, the result stays attached to all candidates,
+	 *  so switching between them is just a change of the index, that doesn't change
+	 *  the topology of the graph and doesn't cause rescheduling. Changes of candidates
+	 *  which are not selected are not propagated.
+	 */
+    template <typename I, typename S, typename... Ss>
+    UREACT_WARN_UNUSED_RESULT auto operator()( const signal<I>& index,
+        const signal<S>& candidate,
+        const signal<Ss>&... candidates ) const
+    {
+        static_assert( std::is_integral_v<I> || std::is_enum_v<I>,
+            "switch_on: index should be of integral or enumeration type" );
+        static_assert( ( std::is_same_v<S, Ss> && ... ),
+            "switch_on: all candidates should have the same value type" );
+
+        constexpr size_t N = 1 + sizeof...( Ss );
+        using Node = signal_switch_node<I, S, N>;
+
+        return create_wrapped_node<signal<S>, Node>( index.get_context(),
+            index,
+            std::array<signal<S>, N>{ candidate, candidates... } );
+    }
+};
+
+} // namespace detail
+
+/*!
+ * @brief Create a new signal with the value of the candidate selected by index
+ */
+inline constexpr detail::SwitchOnAdaptor switch_on;
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_ADAPTOR_SWITCH_ON_HPP
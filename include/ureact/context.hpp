@@ -80,6 +80,31 @@ public:
         return !( lhs == rhs );
     }
 
+    /*!
+     * @brief Set the max number of follow-up turns within a single propagation
+     *
+     *  Follow-up turns apply inputs deferred from callbacks, see var_signal::set_deferred()
+     *  and event_source::emit_deferred(). Deferred inputs that exceed the limit stay queued
+     *  until the next propagation. Default value is 100.
+     *
+     *  @note count should be greater than zero, otherwise deferred inputs are never applied
+     */
+    void set_max_deferred_turns( size_t count );
+
+    /*!
+     * @brief Fuse chains of signal nodes that have a single consumer
+     *
+     *  Signal nodes calculated by functions that have exactly one successor are no longer
+     *  scheduled on their own. Instead, they are updated on demand right before their successor
+     *  is updated. It removes scheduling overhead of intermediate signals stored in variables,
+     *  that can't be merged into their consumer as temporary signals do.
+     *
+     *  Attaching another successor to a fused node unfuses it, so the graph behaves the same
+     *  before and after the call. Nodes created after the call are not fused until the next call.
+     *  Can't be called during propagation.
+     */
+    void freeze();
+
     /*!
      * @brief Return internals. Not intended to use in user code
      */
@@ -41,6 +41,16 @@ UREACT_FUNC context::context( std::shared_ptr<detail::react_graph> graph )
     : detail::context_internals( std::move( graph ) )
 {}
 
+UREACT_FUNC void context::set_max_deferred_turns( const size_t count )
+{
+    get_graph().set_max_deferred_turns( count );
+}
+
+UREACT_FUNC void context::freeze()
+{
+    get_graph().fuse_nodes();
+}
+
 namespace default_context
 {
 
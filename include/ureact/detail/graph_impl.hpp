@@ -20,6 +20,12 @@ UREACT_BEGIN_NAMESPACE
 namespace detail
 {
 
+class shared_node_table;
+
+/// Owning pointer to shared_node_table. Deleter is provided where the table type is complete,
+/// so the graph doesn't depend on the table header
+using shared_node_table_ptr = std::unique_ptr<shared_node_table, void ( * )( shared_node_table* )>;
+
 #if !defined( NDEBUG )
 struct callback_sanitizer
 {
@@ -75,11 +81,28 @@ struct react_graph
         = 0;
     virtual void unregister_node( node_id nodeId ) = 0;
 
+    /// Preallocate storage for at least count nodes in total
+    virtual void reserve_nodes( size_t count ) = 0;
+    UREACT_WARN_UNUSED_RESULT virtual size_t node_count() const = 0;
+    UREACT_WARN_UNUSED_RESULT virtual size_t node_capacity() const = 0;
+
     virtual void attach_node( node_id nodeId, node_id parentId ) = 0;
     virtual void detach_node( node_id nodeId, node_id parentId ) = 0;
 
     virtual void push_input( node_id nodeId ) = 0;
 
+    /// Queue input that is applied in a follow-up turn of the current or the next propagation
+    virtual void push_deferred_input( node_id nodeId ) = 0;
+
+    /// Set the max number of follow-up turns within a single propagation
+    virtual void set_max_deferred_turns( size_t count ) = 0;
+
+    /// Fuse fusable nodes with a single successor into that successor
+    virtual void fuse_nodes() = 0;
+
+    /// Return storage of table of structurally identical nodes. It is null until first use
+    UREACT_WARN_UNUSED_RESULT virtual shared_node_table_ptr& get_shared_nodes() = 0;
+
     virtual void start_transaction() = 0;
     virtual void finish_transaction() = 0;
 
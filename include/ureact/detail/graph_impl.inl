@@ -10,6 +10,7 @@
 #ifndef UREACT_DETAIL_GRAPH_IMPL_INL
 #define UREACT_DETAIL_GRAPH_IMPL_INL
 
+#include <atomic>
 #include <cassert>
 #include <limits>
 #include <memory>
@@ -58,11 +59,23 @@ public:
         node_id nodeId, const std::weak_ptr<reactive_node_interface>& nodePtr ) override;
     void unregister_node( node_id nodeId ) override;
 
+    void reserve_nodes( size_t count ) override;
+    UREACT_WARN_UNUSED_RESULT size_t node_count() const override;
+    UREACT_WARN_UNUSED_RESULT size_t node_capacity() const override;
+
     void attach_node( node_id nodeId, node_id parentId ) override;
     void detach_node( node_id nodeId, node_id parentId ) override;
 
     void push_input( node_id nodeId ) override;
 
+    void push_deferred_input( node_id nodeId ) override;
+
+    void set_max_deferred_turns( size_t count ) override;
+
+    void fuse_nodes() override;
+
+    UREACT_WARN_UNUSED_RESULT shared_node_table_ptr& get_shared_nodes() override;
+
     void start_transaction() override;
     void finish_transaction() override;
 
@@ -83,9 +96,20 @@ private:
         int new_level = 0;
         bool queued = false;
 
+        // Node has a changed predecessor and should be updated
+        bool dirty = false;
+
+        // Node is updated on demand by its only successor instead of being scheduled
+        bool fused = false;
+
+        // Node is in the list of deferred inputs
+        bool deferred = false;
+
         std::weak_ptr<reactive_node_interface> node_ptr;
 
         node_id_vector successors;
+
+        node_id_vector fused_predecessors;
     };
 
     class topological_queue
@@ -112,6 +136,12 @@ private:
             return m_queue_data.empty() && m_next_data.empty();
         }
 
+        void clear()
+        {
+            m_next_data.clear();
+            m_queue_data.clear();
+        }
+
     private:
         using entry = std::pair<value_type, int>;
 
@@ -125,18 +155,30 @@ private:
 
     void propagate();
 
+    void abort_propagation();
+
     void recalculate_successor_levels( node_data& parentNode );
 
     void schedule_node( node_id nodeId );
 
+    void enqueue_node( node_id nodeId );
+
     void re_schedule_node( node_id nodeId );
 
     void schedule_successors( node_data& parentNode );
 
     void propagate_node_change( node_id nodeId );
 
+    void update_fused_predecessors( node_data& node );
+
+    UREACT_WARN_UNUSED_RESULT bool update_fused_node( node_id nodeId );
+
+    void unfuse_node( node_id nodeId, node_data& node );
+
     void finalize_changed_nodes();
 
+    void apply_deferred_inputs();
+
     void unregister_queued_nodes();
 
     node_id::context_id_type m_id = create_context_id();
@@ -153,6 +195,12 @@ private:
     node_id_vector m_changed_nodes;
 
     node_id_vector m_nodes_queued_for_unregister;
+
+    node_id_vector m_deferred_inputs;
+
+    size_t m_max_deferred_turns = 100;
+
+    shared_node_table_ptr m_shared_nodes{ nullptr, nullptr };
 };
 
 UREACT_FUNC react_graph_impl::~react_graph_impl()
@@ -163,6 +211,7 @@ UREACT_FUNC react_graph_impl::~react_graph_impl()
     assert( m_propagation_is_in_progress == false );
     assert( m_changed_nodes.empty() );
     assert( m_nodes_queued_for_unregister.empty() );
+    assert( m_deferred_inputs.empty() );
 }
 
 UREACT_FUNC node_id react_graph_impl::register_node()
@@ -184,6 +233,11 @@ UREACT_FUNC void react_graph_impl::unregister_node( const node_id nodeId )
 {
     assert( nodeId.context_id() == m_id );
     assert( m_node_data[nodeId].successors.empty() );
+    assert( m_node_data[nodeId].fused_predecessors.empty() );
+
+    // Deferred input can outlive the propagation if the follow-up turn limit is reached
+    if( m_node_data[nodeId].deferred )
+        m_deferred_inputs.remove( nodeId );
 
     if( can_unregister_node() )
         m_node_data.erase( nodeId );
@@ -191,6 +245,21 @@ UREACT_FUNC void react_graph_impl::unregister_node( const node_id nodeId )
         m_nodes_queued_for_unregister.add( nodeId );
 }
 
+UREACT_FUNC void react_graph_impl::reserve_nodes( const size_t count )
+{
+    m_node_data.reserve( count );
+}
+
+UREACT_FUNC size_t react_graph_impl::node_count() const
+{
+    return m_node_data.size();
+}
+
+UREACT_FUNC size_t react_graph_impl::node_capacity() const
+{
+    return m_node_data.capacity();
+}
+
 UREACT_FUNC void react_graph_impl::attach_node( const node_id nodeId, const node_id parentId )
 {
     assert( nodeId.context_id() == m_id );
@@ -199,6 +268,10 @@ UREACT_FUNC void react_graph_impl::attach_node( const node_id nodeId, const node
     node_data& node = m_node_data[nodeId];
     node_data& parent = m_node_data[parentId];
 
+    // Fused node can have only one successor
+    if( parent.fused )
+        unfuse_node( parentId, parent );
+
     parent.successors.add( nodeId );
 
     node.level = std::max( node.level, parent.level + 1 );
@@ -212,6 +285,9 @@ UREACT_FUNC void react_graph_impl::detach_node( const node_id nodeId, const node
     node_data& parent = m_node_data[parentId];
     node_id_vector& successors = parent.successors;
 
+    if( parent.fused )
+        unfuse_node( parentId, parent );
+
     successors.remove( nodeId );
 }
 
@@ -225,6 +301,50 @@ UREACT_FUNC void react_graph_impl::push_input( const node_id nodeId )
         propagate();
 }
 
+UREACT_FUNC void react_graph_impl::push_deferred_input( const node_id nodeId )
+{
+    assert( nodeId.context_id() == m_id );
+
+    node_data& node = m_node_data[nodeId];
+    if( !node.deferred )
+    {
+        node.deferred = true;
+        m_deferred_inputs.add( nodeId );
+    }
+
+    if( !m_propagation_is_in_progress && m_transaction_level == 0 )
+        propagate();
+}
+
+UREACT_FUNC void react_graph_impl::set_max_deferred_turns( const size_t count )
+{
+    // With zero follow-up turns deferred inputs would never be applied
+    assert( count > 0 && "Max number of deferred turns should be positive" );
+    m_max_deferred_turns = count;
+}
+
+UREACT_FUNC void react_graph_impl::fuse_nodes()
+{
+    assert( !m_propagation_is_in_progress );
+
+    m_node_data.for_each( [this]( const size_t index, node_data& node ) {
+        if( node.fused || node.successors.size() != 1 )
+            return;
+
+        const std::shared_ptr<reactive_node_interface> nodePtr = node.node_ptr.lock();
+        if( nodePtr && nodePtr->is_fusable() )
+        {
+            node.fused = true;
+            m_node_data[*node.successors.begin()].fused_predecessors.add( node_id{ m_id, index } );
+        }
+    } );
+}
+
+UREACT_FUNC shared_node_table_ptr& react_graph_impl::get_shared_nodes()
+{
+    return m_shared_nodes;
+}
+
 UREACT_FUNC void react_graph_impl::start_transaction()
 {
     assert( !m_propagation_is_in_progress );
@@ -245,8 +365,9 @@ UREACT_FUNC void react_graph_impl::finish_transaction()
 
 UREACT_FUNC node_id::context_id_type react_graph_impl::create_context_id()
 {
-    static node_id::context_id_type s_next_id = 1u;
-    return s_next_id++;
+    // Contexts can be created concurrently, e.g. from callbacks run by finish_parallel()
+    static std::atomic<node_id::context_id_type> s_next_id{ 1u };
+    return s_next_id.fetch_add( 1u, std::memory_order_relaxed );
 }
 
 UREACT_FUNC bool react_graph_impl::can_unregister_node() const
@@ -258,9 +379,44 @@ UREACT_FUNC void react_graph_impl::propagate()
 {
     m_propagation_is_in_progress = true;
 
-    while( m_scheduled_nodes.fetch_next() )
-        for( const node_id nodeId : m_scheduled_nodes.next_values() )
-            propagate_node_change( nodeId );
+    try
+    {
+        for( size_t deferred_turns = 0;; ++deferred_turns )
+        {
+            while( m_scheduled_nodes.fetch_next() )
+                for( const node_id nodeId : m_scheduled_nodes.next_values() )
+                    propagate_node_change( nodeId );
+
+            finalize_changed_nodes();
+
+            // Inputs deferred from callbacks are applied in follow-up turns
+            if( m_deferred_inputs.empty() || deferred_turns == m_max_deferred_turns )
+                break;
+
+            apply_deferred_inputs();
+        }
+    }
+    catch( ... )
+    {
+        abort_propagation();
+        throw;
+    }
+
+    m_propagation_is_in_progress = false;
+
+    unregister_queued_nodes();
+}
+
+UREACT_FUNC void react_graph_impl::abort_propagation()
+{
+    // The rest of the turn is dropped, so the graph stays usable after a callback throws
+    m_scheduled_nodes.clear();
+    m_deferred_inputs.clear();
+    m_node_data.for_each( []( size_t, node_data& node ) {
+        node.queued = false;
+        node.dirty = false;
+        node.deferred = false;
+    } );
 
     finalize_changed_nodes();
 
@@ -279,13 +435,24 @@ UREACT_FUNC void react_graph_impl::recalculate_successor_levels( node_data& pare
 }
 
 UREACT_FUNC void react_graph_impl::schedule_node( const node_id nodeId )
+{
+    m_node_data[nodeId].dirty = true;
+    enqueue_node( nodeId );
+}
+
+UREACT_FUNC void react_graph_impl::enqueue_node( const node_id nodeId )
 {
     node_data& node = m_node_data[nodeId];
 
     if( !node.queued )
     {
         node.queued = true;
-        m_scheduled_nodes.push( nodeId, node.level );
+
+        // Fused node is updated by its successor, so the successor is queued instead
+        if( node.fused )
+            enqueue_node( *node.successors.begin() );
+        else
+            m_scheduled_nodes.push( nodeId, node.level );
     }
 }
 
@@ -307,6 +474,9 @@ UREACT_FUNC void react_graph_impl::propagate_node_change( const node_id nodeId )
     node_data& node = m_node_data[nodeId];
     if( std::shared_ptr<reactive_node_interface> nodePtr = node.node_ptr.lock() )
     {
+        if( !node.fused_predecessors.empty() )
+            update_fused_predecessors( node );
+
         // A predecessor of this node has shifted to a lower level?
         if( node.level < node.new_level )
         {
@@ -315,6 +485,13 @@ UREACT_FUNC void react_graph_impl::propagate_node_change( const node_id nodeId )
             return;
         }
 
+        // Queued only because of fused predecessors, that haven't changed
+        if( !node.dirty )
+        {
+            node.queued = false;
+            return;
+        }
+
         const update_result result = nodePtr->update();
 
         // Topology changed?
@@ -332,6 +509,64 @@ UREACT_FUNC void react_graph_impl::propagate_node_change( const node_id nodeId )
     }
 
     node.queued = false;
+    node.dirty = false;
+}
+
+UREACT_FUNC void react_graph_impl::update_fused_predecessors( node_data& node )
+{
+    for( const node_id predecessorId : node.fused_predecessors )
+        if( update_fused_node( predecessorId ) )
+            node.dirty = true;
+}
+
+UREACT_FUNC bool react_graph_impl::update_fused_node( const node_id nodeId )
+{
+    node_data& node = m_node_data[nodeId];
+    if( !node.queued )
+        return false;
+
+    if( !node.fused_predecessors.empty() )
+        update_fused_predecessors( node );
+
+    // Level changes are passed to the successor that takes care of re-scheduling
+    if( node.level < node.new_level )
+    {
+        node.level = node.new_level;
+        recalculate_successor_levels( node );
+    }
+
+    bool changed = false;
+    if( node.dirty )
+    {
+        if( std::shared_ptr<reactive_node_interface> nodePtr = node.node_ptr.lock() )
+        {
+            const update_result result = nodePtr->update();
+            assert( result != update_result::shifted && "Fused node can't change topology" );
+
+            if( result == update_result::changed )
+            {
+                m_changed_nodes.add( nodeId );
+                changed = true;
+            }
+        }
+    }
+
+    node.queued = false;
+    node.dirty = false;
+
+    return changed;
+}
+
+UREACT_FUNC void react_graph_impl::unfuse_node( const node_id nodeId, node_data& node )
+{
+    assert( node.successors.size() == 1 );
+
+    node.fused = false;
+    m_node_data[*node.successors.begin()].fused_predecessors.remove( nodeId );
+
+    // Pending node should be updated on its own now
+    if( node.queued )
+        m_scheduled_nodes.push( nodeId, node.level );
 }
 
 UREACT_FUNC void react_graph_impl::finalize_changed_nodes()
@@ -348,6 +583,21 @@ UREACT_FUNC void react_graph_impl::finalize_changed_nodes()
     m_changed_nodes.clear();
 }
 
+UREACT_FUNC void react_graph_impl::apply_deferred_inputs()
+{
+    for( const node_id nodeId : m_deferred_inputs )
+    {
+        node_data& node = m_node_data[nodeId];
+        node.deferred = false;
+        if( std::shared_ptr<reactive_node_interface> nodePtr = node.node_ptr.lock() )
+        {
+            nodePtr->apply_deferred_input();
+            schedule_node( nodeId );
+        }
+    }
+    m_deferred_inputs.clear();
+}
+
 UREACT_FUNC void react_graph_impl::unregister_queued_nodes()
 {
     assert( !m_propagation_is_in_progress );
@@ -73,6 +73,16 @@ struct reactive_node_interface
     /// Called after change propagation on changed nodes
     virtual void finalize()
     {}
+
+    /// Called before a follow-up turn on nodes that have queued deferred input
+    virtual void apply_deferred_input()
+    {}
+
+    /// Return if the node can be updated on demand by its only successor instead of being scheduled
+    UREACT_WARN_UNUSED_RESULT virtual bool is_fusable() const
+    {
+        return false;
+    }
 };
 
 struct observer_interface
@@ -10,7 +10,10 @@
 #ifndef UREACT_DETAIL_HAS_CHANGED_HPP
 #define UREACT_DETAIL_HAS_CHANGED_HPP
 
+#include <array>
+#include <cstring>
 #include <type_traits>
+#include <vector>
 
 #include <ureact/detail/defines.hpp>
 
@@ -33,6 +36,75 @@ UREACT_WARN_UNUSED_RESULT constexpr bool has_changed( const T lhs, const T rhs )
     return !( lhs == rhs );
 }
 
+namespace has_changed_detail
+{
+
+// Compare same sized arrays of arithmetic values
+template <class T>
+UREACT_WARN_UNUSED_RESULT bool has_changed_range( const T* lhs, const T* rhs, size_t size ) noexcept
+{
+    if constexpr( std::is_integral_v<T> )
+    {
+        // Integers have no padding and no values that are equal with different representation
+        return size != 0 && std::memcmp( lhs, rhs, size * sizeof( T ) ) != 0;
+    }
+    else
+    {
+        // memcmp is not suitable for floating point values because of NaN and -0.0
+        // Each block has a constant trip count and is compared without branching,
+        // so the inner loop can be vectorized even with -O2
+        constexpr size_t block_size = 64;
+
+        size_t i = 0;
+        for( ; i + block_size <= size; i += block_size )
+        {
+            unsigned changed = 0;
+            for( size_t j = 0; j < block_size; ++j )
+                changed |= static_cast<unsigned>( !( lhs[i + j] == rhs[i + j] ) );
+            if( changed != 0 )
+                return true;
+        }
+
+        for( ; i < size; ++i )
+            if( !( lhs[i] == rhs[i] ) )
+                return true;
+
+        return false;
+    }
+}
+
+} // namespace has_changed_detail
+
+/*!
+ * @brief has_changed overload for std::vector of arithmetic types
+ *
+ * Sizes are compared first, then contents are compared with memcmp or with vectorizable loop
+ *
+ * @note BREAKING! Before this overload was added, each set of such a signal was propagated,
+ *       now setting an equal value is not propagated
+ */
+template <class T,
+    class Alloc,
+    class = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+UREACT_WARN_UNUSED_RESULT bool has_changed(
+    const std::vector<T, Alloc>& lhs, const std::vector<T, Alloc>& rhs ) noexcept
+{
+    return lhs.size() != rhs.size()
+        || has_changed_detail::has_changed_range( lhs.data(), rhs.data(), lhs.size() );
+}
+
+/*!
+ * @brief has_changed overload for std::array of arithmetic types
+ *
+ * @note BREAKING! Like for std::vector, setting an equal value is no longer propagated
+ */
+template <class T, size_t N, class = std::enable_if_t<std::is_arithmetic_v<T>>>
+UREACT_WARN_UNUSED_RESULT bool has_changed(
+    const std::array<T, N>& lhs, const std::array<T, N>& rhs ) noexcept
+{
+    return has_changed_detail::has_changed_range( lhs.data(), rhs.data(), N );
+}
+
 #if defined( __clang__ ) && defined( __clang_minor__ )
 #    pragma clang diagnostic pop
 #endif
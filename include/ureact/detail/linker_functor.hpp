@@ -54,7 +54,7 @@ private:
     template <typename T>
     void attach( const std::shared_ptr<T>& dep_ptr ) const
     {
-        this->m_node.attach_to( dep_ptr->get_node_id() );
+        this->m_node.attach_to_non_constant( *dep_ptr );
     }
 };
 
@@ -82,7 +82,7 @@ private:
     template <typename T>
     void detach( const std::shared_ptr<T>& dep_ptr ) const
     {
-        this->m_node.detach_from( dep_ptr->get_node_id() );
+        this->m_node.detach_from_non_constant( *dep_ptr );
     }
 };
 
@@ -62,6 +62,12 @@ public:
         return m_context;
     }
 
+    /// Constant node never changes, so successors don't attach to it and it is never scheduled
+    UREACT_WARN_UNUSED_RESULT bool is_constant() const
+    {
+        return m_is_constant;
+    }
+
 protected:
     UREACT_WARN_UNUSED_RESULT react_graph& get_graph();
     UREACT_WARN_UNUSED_RESULT const react_graph& get_graph() const;
@@ -72,10 +78,15 @@ protected:
 
     void detach_from_all();
 
+    void mark_as_constant()
+    {
+        m_is_constant = true;
+    }
+
     template <class... Deps>
     void attach_to( const Deps&... deps )
     {
-        ( attach_to( get_internals( deps ).get_node_id() ), ... );
+        ( attach_to_non_constant( *get_internals( deps ).get_node_ptr() ), ... );
     }
 
     template <class... Deps>
@@ -88,6 +99,18 @@ protected:
             tp );
     }
 
+    template <class... Deps>
+    UREACT_WARN_UNUSED_RESULT static bool are_all_constant( const Deps&... deps )
+    {
+        return ( get_internals( deps ).get_node_ptr()->is_constant() && ... );
+    }
+
+    template <class... Deps>
+    UREACT_WARN_UNUSED_RESULT static bool is_any_constant( const Deps&... deps )
+    {
+        return ( get_internals( deps ).get_node_ptr()->is_constant() || ... );
+    }
+
     template <typename Node>
     friend class attach_functor;
 
@@ -97,11 +120,25 @@ protected:
 private:
     UREACT_MAKE_NONCOPYABLE( node_base );
 
+    void attach_to_non_constant( const node_base& parent )
+    {
+        if( !parent.is_constant() )
+            attach_to( parent.get_node_id() );
+    }
+
+    void detach_from_non_constant( const node_base& parent )
+    {
+        if( !parent.is_constant() )
+            detach_from( parent.get_node_id() );
+    }
+
     context m_context{};
 
     node_id m_id;
 
     node_id_vector m_parents;
+
+    bool m_is_constant = false;
 };
 
 } // namespace detail
@@ -31,6 +31,7 @@ public:
     void remove( node_id id );
     void clear();
     UREACT_WARN_UNUSED_RESULT bool empty() const;
+    UREACT_WARN_UNUSED_RESULT size_t size() const;
 
     UREACT_WARN_UNUSED_RESULT iterator begin();
     UREACT_WARN_UNUSED_RESULT iterator end();
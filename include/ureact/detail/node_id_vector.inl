@@ -52,6 +52,11 @@ UREACT_FUNC bool node_id_vector::empty() const
     return m_data.empty();
 }
 
+UREACT_FUNC size_t node_id_vector::size() const
+{
+    return m_data.size();
+}
+
 UREACT_FUNC node_id_vector::iterator node_id_vector::begin()
 {
     return m_data.begin();
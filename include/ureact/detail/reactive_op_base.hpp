@@ -43,6 +43,16 @@ public:
         std::apply( detach_functor<Node>{ node }, m_deps );
     }
 
+    /// Check if all dependencies are constant, so the result is constant as well
+    UREACT_WARN_UNUSED_RESULT bool is_constant() const
+    {
+        return std::apply(
+            []( const auto&... deps ) { //
+                return ( is_constant_dep( deps ) && ... );
+            },
+            m_deps );
+    }
+
     template <typename Node, typename Functor>
     void attach_rec( const Functor& functor ) const
     {
@@ -58,6 +68,19 @@ public:
 
 protected:
     dep_holder_t m_deps;
+
+private:
+    template <typename T>
+    UREACT_WARN_UNUSED_RESULT static bool is_constant_dep( const T& op )
+    {
+        return op.is_constant();
+    }
+
+    template <typename T>
+    UREACT_WARN_UNUSED_RESULT static bool is_constant_dep( const std::shared_ptr<T>& dep_ptr )
+    {
+        return dep_ptr->is_constant();
+    }
 };
 
 } // namespace detail
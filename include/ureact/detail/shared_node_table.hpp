@@ -0,0 +1,86 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_DETAIL_SHARED_NODE_TABLE_HPP
+#define UREACT_DETAIL_SHARED_NODE_TABLE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include <ureact/detail/defines.hpp>
+#include <ureact/detail/graph_impl.hpp>
+#include <ureact/detail/graph_interface.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+/// Structural identity of a node: its type, identity of its function and its dependencies
+struct shared_node_key
+{
+    std::type_index node_type;
+    std::uintptr_t func_id;
+    std::vector<node_id> deps;
+
+    UREACT_WARN_UNUSED_RESULT bool operator==( const shared_node_key& other ) const
+    {
+        return node_type == other.node_type && func_id == other.func_id && deps == other.deps;
+    }
+};
+
+/// Table of structurally identical nodes shared within a context
+class shared_node_table
+{
+public:
+    /// Return alive node with the given key or nullptr
+    UREACT_WARN_UNUSED_RESULT std::shared_ptr<reactive_node_interface> find(
+        const shared_node_key& key ) const;
+
+    /// Add node with the given key, replacing the expired one if any
+    void insert( shared_node_key key, const std::weak_ptr<reactive_node_interface>& nodePtr );
+
+private:
+    struct key_hash
+    {
+        UREACT_WARN_UNUSED_RESULT size_t operator()( const shared_node_key& key ) const;
+    };
+
+    void erase_expired();
+
+    std::unordered_map<shared_node_key, std::weak_ptr<reactive_node_interface>, key_hash>
+        m_nodes;
+
+    // Expired entries are erased when the table grows beyond this size
+    size_t m_cleanup_size = 64;
+};
+
+/// Return table of structurally identical nodes of the graph. It is created on first use
+UREACT_WARN_UNUSED_RESULT inline shared_node_table& get_shared_node_table( react_graph& graph )
+{
+    shared_node_table_ptr& table = graph.get_shared_nodes();
+    if( !table )
+    {
+        table = shared_node_table_ptr(
+            new shared_node_table, []( shared_node_table* ptr ) { delete ptr; } );
+    }
+    return *table;
+}
+
+} // namespace detail
+
+UREACT_END_NAMESPACE
+
+#if UREACT_HEADER_ONLY
+#    include <ureact/detail/shared_node_table.inl>
+#endif
+
+#endif // UREACT_DETAIL_SHARED_NODE_TABLE_HPP
@@ -0,0 +1,73 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_DETAIL_SHARED_NODE_TABLE_INL
+#define UREACT_DETAIL_SHARED_NODE_TABLE_INL
+
+#include <algorithm>
+
+#include <ureact/detail/defines.hpp>
+#include <ureact/detail/shared_node_table.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+UREACT_FUNC std::shared_ptr<reactive_node_interface> shared_node_table::find(
+    const shared_node_key& key ) const
+{
+    const auto it = m_nodes.find( key );
+    if( it == m_nodes.end() )
+        return nullptr;
+    return it->second.lock();
+}
+
+UREACT_FUNC void shared_node_table::insert(
+    shared_node_key key, const std::weak_ptr<reactive_node_interface>& nodePtr )
+{
+    m_nodes.insert_or_assign( std::move( key ), nodePtr );
+
+    if( m_nodes.size() >= m_cleanup_size )
+    {
+        erase_expired();
+        m_cleanup_size = std::max( m_cleanup_size, m_nodes.size() * 2 );
+    }
+}
+
+UREACT_FUNC void shared_node_table::erase_expired()
+{
+    for( auto it = m_nodes.begin(); it != m_nodes.end(); )
+    {
+        if( it->second.expired() )
+            it = m_nodes.erase( it );
+        else
+            ++it;
+    }
+}
+
+UREACT_FUNC size_t shared_node_table::key_hash::operator()( const shared_node_key& key ) const
+{
+    // boost::hash_combine
+    size_t seed = key.node_type.hash_code();
+    const auto combine = [&seed]( const size_t value ) {
+        seed ^= value + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+    };
+
+    combine( static_cast<size_t>( key.func_id ) );
+    for( const node_id id : key.deps )
+        combine( static_cast<node_id::value_type>( id ) );
+
+    return seed;
+}
+
+} // namespace detail
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_DETAIL_SHARED_NODE_TABLE_INL
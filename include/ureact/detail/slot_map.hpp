@@ -146,6 +146,35 @@ public:
         return m_capacity;
     }
 
+    /// Call func(index, element) for each used slot
+    template <class F>
+    void for_each( F&& func )
+    {
+        // Skip over sorted free indices
+        const size_type size = total_size();
+        const size_type* free_it = m_free_indices.begin();
+        const size_type* free_ite = m_free_indices.end();
+        for( size_type i = 0; i < size; ++i )
+        {
+            if( free_it != free_ite && *free_it == i )
+            {
+                ++free_it;
+                continue;
+            }
+
+            func( i, *at( i ) );
+        }
+    }
+
+    /// Increase capacity to at least new_capacity, keeping slot indices intact
+    void reserve( const size_type new_capacity )
+    {
+        if( new_capacity > m_capacity )
+        {
+            reallocate( new_capacity );
+        }
+    }
+
     /// Clear the data, leave capacity intact
     void clear()
     {
@@ -249,6 +278,13 @@ private:
             detail::sort( begin_(), end_() );
         }
 
+        /// Push index greater than all stored ones, so the order is kept without sorting
+        void push_back_sorted( const size_type index )
+        {
+            assert( m_size == 0 || back_() < index );
+            m_data[m_size++] = index;
+        }
+
         UREACT_WARN_UNUSED_RESULT size_type pop()
         {
             // TODO: It should take lowest free index instead to increase probability of successful shake.
@@ -274,14 +310,15 @@ private:
             return it != end();
         }
 
+        // Pointers are taken without operator[], because m_data is null before the first grow
         UREACT_WARN_UNUSED_RESULT const size_type* begin() const
         {
-            return &m_data[0];
+            return m_data.get();
         }
 
         UREACT_WARN_UNUSED_RESULT const size_type* end() const
         {
-            return &m_data[m_size];
+            return m_data.get() + m_size;
         }
 
     private:
@@ -292,12 +329,12 @@ private:
 
         UREACT_WARN_UNUSED_RESULT size_type* begin_()
         {
-            return &m_data[0];
+            return m_data.get();
         }
 
         UREACT_WARN_UNUSED_RESULT size_type* end_()
         {
-            return &m_data[m_size];
+            return m_data.get() + m_size;
         }
 
         std::unique_ptr<size_type[]> m_data;
@@ -338,26 +375,40 @@ private:
         assert( m_size == m_capacity );
         assert( m_free_indices.empty() );
 
-        // Allocate new storage
-        const size_type new_capacity = calculate_next_capacity();
+        reallocate( calculate_next_capacity() );
+    }
+
+    void reallocate( const size_type new_capacity )
+    {
+        assert( new_capacity > m_capacity );
 
+        // Allocate new storage
         auto new_storage = std::make_unique<storage_type[]>( new_capacity );
+        free_indices new_free_indices{ new_capacity };
 
-        // Move data to new storage
+        // Move data to new storage, skipping over sorted free indices
         // TODO: maybe should be replaced with std::uninitialized_move_n?
-        for( size_type i = 0; i < m_capacity; ++i )
+        const size_type size = total_size();
+        const size_type* free_it = m_free_indices.begin();
+        const size_type* free_ite = m_free_indices.end();
+        for( size_type i = 0; i < size; ++i )
         {
+            if( free_it != free_ite && *free_it == i )
+            {
+                new_free_indices.push_back_sorted( i );
+                ++free_it;
+                continue;
+            }
+
             value_type* dst = std::addressof( new_storage[i].data );
             value_type* src = std::addressof( m_storage[i].data );
             detail::construct_at( dst, std::move( *src ) );
             detail::destroy_at( src );
         }
 
-        // Free list is empty if we are at max capacity anyway
-
         // Use new storage
         m_storage = std::move( new_storage );
-        m_free_indices = free_indices{ new_capacity };
+        m_free_indices = std::move( new_free_indices );
         m_capacity = new_capacity;
     }
 
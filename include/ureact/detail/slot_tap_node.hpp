@@ -0,0 +1,74 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_DETAIL_SLOT_TAP_NODE_HPP
+#define UREACT_DETAIL_SLOT_TAP_NODE_HPP
+
+#include <ureact/detail/defines.hpp>
+#include <ureact/detail/node_base.hpp>
+#include <ureact/signal.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+/// Node with many inputs that needs to know which of them have changed
+class slot_tap_owner
+{
+public:
+    virtual void mark_slot_changed( size_t slot ) = 0;
+
+protected:
+    ~slot_tap_owner() = default;
+};
+
+/// Node forwarding changes of a single signal to its owner, so the owner knows which slot changed
+template <typename S>
+class slot_tap_node final : public node_base
+{
+public:
+    slot_tap_node( const context& context,
+        slot_tap_owner& owner,
+        const size_t slot,
+        const signal<S>& subject )
+        : node_base( context )
+        , m_owner( owner )
+        , m_slot( slot )
+        , m_subject( subject )
+    {
+        this->attach_to( m_subject );
+    }
+
+    ~slot_tap_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        m_owner.mark_slot_changed( m_slot );
+        return update_result::changed;
+    }
+
+    UREACT_WARN_UNUSED_RESULT const S& value_ref() const
+    {
+        return get_internals( m_subject ).value_ref();
+    }
+
+private:
+    slot_tap_owner& m_owner;
+    size_t m_slot;
+    signal<S> m_subject;
+};
+
+} // namespace detail
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_DETAIL_SLOT_TAP_NODE_HPP
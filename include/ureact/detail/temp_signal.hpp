@@ -30,7 +30,11 @@ public:
     {
         this->m_value = evaluate();
 
-        m_op.attach( *this );
+        // Function of constants is folded into a constant at construction time
+        if( m_op.is_constant() )
+            this->mark_as_constant();
+        else
+            m_op.attach( *this );
     }
 
     ~signal_op_node() override
@@ -46,6 +50,12 @@ public:
         return this->try_change_value( evaluate() );
     }
 
+    // Value is recalculated and compared, so an extra update on demand is harmless
+    UREACT_WARN_UNUSED_RESULT bool is_fusable() const override
+    {
+        return true;
+    }
+
     UREACT_WARN_UNUSED_RESULT Op steal_op()
     {
         assert( !m_was_op_stolen && "Op was already stolen" );
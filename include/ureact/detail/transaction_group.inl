@@ -0,0 +1,119 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_DETAIL_TRANSACTION_GROUP_INL
+#define UREACT_DETAIL_TRANSACTION_GROUP_INL
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <thread>
+
+#include <ureact/context.hpp>
+#include <ureact/detail/defines.hpp>
+#include <ureact/detail/graph_impl.hpp>
+#include <ureact/transaction_group.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+UREACT_FUNC transaction_group::transaction_group( std::initializer_list<context> contexts )
+    : transaction_group( std::vector<context>( contexts ) )
+{}
+
+UREACT_FUNC transaction_group::transaction_group( std::vector<context> contexts )
+{
+    // The same graph can't be propagated twice, especially concurrently
+    m_contexts.reserve( contexts.size() );
+    for( context& ctx : contexts )
+        if( std::find( m_contexts.begin(), m_contexts.end(), ctx ) == m_contexts.end() )
+            m_contexts.push_back( std::move( ctx ) );
+
+    for( context& ctx : m_contexts )
+    {
+        auto& graph = get_internals( ctx ).get_graph();
+        assert( !graph.is_propagation_in_progress()
+                && "Can't start transaction in the middle of the change propagation process" );
+        graph.start_transaction();
+    }
+}
+
+UREACT_FUNC transaction_group::~transaction_group()
+{
+    finish_impl();
+}
+
+UREACT_FUNC void transaction_group::finish()
+{
+    finish_impl();
+}
+
+UREACT_FUNC void transaction_group::finish_parallel()
+{
+    if( m_finished )
+        return;
+
+    const size_t count = m_contexts.size();
+    std::vector<std::exception_ptr> errors( count );
+
+    const auto finish_context = [this, &errors]( const size_t i ) {
+        try
+        {
+            get_internals( m_contexts[i] ).get_graph().finish_transaction();
+        }
+        catch( ... )
+        {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    // The last context is propagated by the calling thread
+    std::vector<std::thread> threads;
+    if( count > 1 )
+        threads.reserve( count - 1 );
+    for( size_t i = 0; i + 1 < count; ++i )
+        threads.emplace_back( finish_context, i );
+    if( count > 0 )
+        finish_context( count - 1 );
+
+    for( std::thread& thread : threads )
+        thread.join();
+    m_finished = true;
+
+    for( const std::exception_ptr& error : errors )
+        if( error )
+            std::rethrow_exception( error );
+}
+
+UREACT_FUNC void transaction_group::finish_impl()
+{
+    if( m_finished )
+        return;
+
+    // Each context leaves its transaction even if propagation of a previous one throws
+    std::exception_ptr first_error;
+    for( context& ctx : m_contexts )
+    {
+        try
+        {
+            get_internals( ctx ).get_graph().finish_transaction();
+        }
+        catch( ... )
+        {
+            if( !first_error )
+                first_error = std::current_exception();
+        }
+    }
+    m_finished = true;
+
+    if( first_error )
+        std::rethrow_exception( first_error );
+}
+
+UREACT_END_NAMESPACE
+
+#endif //UREACT_DETAIL_TRANSACTION_GROUP_INL
@@ -59,7 +59,11 @@ public:
         , m_func( std::forward<InF>( func ) )
         , m_slots( sources... )
     {
-        this->attach_to( sources... );
+        // Zip with a source that never emits can't emit anything as well
+        if( this->is_any_constant( sources... ) )
+            this->mark_as_constant();
+        else
+            this->attach_to( sources... );
     }
 
     ~event_zip_node() override
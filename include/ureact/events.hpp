@@ -11,7 +11,9 @@
 #define UREACT_EVENTS_HPP
 
 #include <cassert>
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 #include <ureact/context.hpp>
 #include <ureact/detail/node_base.hpp>
@@ -68,10 +70,61 @@ public:
         this->get_events().push_back( std::forward<V>( v ) );
     }
 
+    // Return if the node has to be queued as deferred input
+    template <typename V>
+    UREACT_WARN_UNUSED_RESULT bool emit_value_deferred( V&& v )
+    {
+        // Most event sources never emit deferred, so the buffer is allocated on first use
+        if( m_deferred_events == nullptr )
+            m_deferred_events = std::make_unique<std::vector<E>>();
+
+        const bool is_first = m_deferred_events->empty();
+        m_deferred_events->push_back( std::forward<V>( v ) );
+        return is_first;
+    }
+
+    void apply_deferred_input() override
+    {
+        if( m_deferred_events == nullptr )
+            return;
+
+        auto& events = this->get_events();
+        if( events.empty() )
+        {
+            // Swap to keep capacity of both buffers
+            events.swap( *m_deferred_events );
+        }
+        else
+        {
+            for( auto&& e : *m_deferred_events )
+                events.push_back( std::move( e ) );
+            m_deferred_events->clear();
+        }
+    }
+
     UREACT_WARN_UNUSED_RESULT update_result update() override
     {
         return !this->get_events().empty() ? update_result::changed : update_result::unchanged;
     }
+
+private:
+    std::unique_ptr<std::vector<E>> m_deferred_events;
+};
+
+template <typename E>
+class event_never_node final : public event_stream_node<E>
+{
+public:
+    explicit event_never_node( const context& context )
+        : event_never_node::event_stream_node( context )
+    {
+        this->mark_as_constant();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        return update_result::unchanged;
+    }
 };
 
 template <typename E>
@@ -134,6 +187,14 @@ protected:
         graph_ref.push_input( node_ptr->get_node_id() );
     }
 
+    template <typename T>
+    void emit_event_deferred( T&& e ) const
+    {
+        event_source_node<E>* node_ptr = get_event_source_node();
+        if( node_ptr->emit_value_deferred( std::forward<T>( e ) ) )
+            get_graph().push_deferred_input( node_ptr->get_node_id() );
+    }
+
     std::shared_ptr<event_stream_node<E>> m_node;
 };
 
@@ -292,6 +353,33 @@ public:
         this->emit_event( unit{} );
     }
 
+    /*!
+     * @brief Adds e to the queue of events emitted in a follow-up turn
+     *
+     * Unlike emit(), it can be called from callbacks, e.g. from observers, to make feedback loops.
+     * Events are emitted in a follow-up turn of the current propagation,
+     * or of the next one if there is no propagation in progress.
+     *
+     * The number of follow-up turns within a single propagation is limited,
+     * see @ref context::set_max_deferred_turns()
+     */
+    void emit_deferred( const E& e ) const
+    {
+        assert( this->is_valid() && "Can't emit from event_source not attached to a node" );
+        this->emit_event_deferred( e );
+    }
+
+    /*!
+     * @brief Adds e to the queue of events emitted in a follow-up turn
+     *
+     * Specialization of emit_deferred(const E& e) for rvalue
+     */
+    void emit_deferred( E&& e ) const
+    {
+        assert( this->is_valid() && "Can't emit from event_source not attached to a node" );
+        this->emit_event_deferred( std::move( e ) );
+    }
+
     /*!
      * @brief Adds e to the queue of outgoing events of the linked event source node
      *
@@ -536,14 +624,14 @@ UREACT_WARN_UNUSED_RESULT auto make_source( const context& context ) -> event_so
  *  Event value type E has to be specified explicitly. It would be unit if it is omitted.
  *
  *  Returned value doesn't have input interface and can be used a placeholder where events is required.
- *  Currently it's just cosmetic function that can be expressed as events<E>{ make_source<E>(context) }
- *  but it can be optimized in future.
+ *  The node is constant: it is never scheduled and nodes depending on it don't attach to it.
+ *  For example, merge() ignores such sources and zip() with such source never emits as well.
  */
 template <typename E = unit>
 UREACT_WARN_UNUSED_RESULT auto make_never( const context& context ) -> events<E>
 {
     assert( !get_internals( context ).get_graph().is_locked() && "Can't make never from callback" );
-    return detail::create_wrapped_node<events<E>, detail::event_source_node<E>>( context );
+    return detail::create_wrapped_node<events<E>, detail::event_never_node<E>>( context );
 }
 
 namespace default_context
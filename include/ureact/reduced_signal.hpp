@@ -0,0 +1,331 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_REDUCED_SIGNAL_HPP
+#define UREACT_REDUCED_SIGNAL_HPP
+
+#include <cassert>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ureact/context.hpp>
+#include <ureact/detail/node_base.hpp>
+#include <ureact/detail/slot_tap_node.hpp>
+#include <ureact/signal.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+/*!
+ * @brief Segment tree over a dynamic set of member signals
+ *
+ *  Leaf i of the tree holds the value of the member in slot i, or identity if the slot is free.
+ *  Each internal node holds the result of the operator applied to its children,
+ *  so the root holds the result of the whole reduction. A change of a single member
+ *  recalculates only internal nodes on the path from its leaf to the root.
+ */
+template <typename S>
+class reduce_signals_node
+    : public signal_node<S>
+    , public slot_tap_owner
+{
+public:
+    reduce_signals_node( const context& context, const S& identity )
+        : reduce_signals_node::signal_node( context, identity )
+        , m_identity( identity )
+        , m_tree( 2, identity )
+    {}
+
+    ~reduce_signals_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT size_t add( const signal<S>& member )
+    {
+        size_t slot;
+        if( !m_free_slots.empty() )
+        {
+            slot = m_free_slots.back();
+            m_free_slots.pop_back();
+        }
+        else
+        {
+            slot = m_taps.size();
+            if( slot == capacity() )
+                grow();
+            m_taps.emplace_back();
+            m_slot_dirty.push_back( false );
+        }
+
+        m_taps[slot] = create_node<slot_tap_node<S>>(
+            this->get_context(), *this, slot, member );
+        this->attach_to( m_taps[slot]->get_node_id() );
+
+        // Attaching can raise the level of this node, but not the levels of its successors
+        m_is_level_raised = true;
+
+        mark_slot_changed( slot );
+        ++m_size;
+        return slot;
+    }
+
+    void remove( const size_t slot )
+    {
+        assert( slot < m_taps.size() && m_taps[slot] != nullptr && "Member is not in the set" );
+
+        this->detach_from( m_taps[slot]->get_node_id() );
+        m_taps[slot].reset();
+
+        m_free_slots.push_back( slot );
+        mark_slot_changed( slot );
+        --m_size;
+    }
+
+    UREACT_WARN_UNUSED_RESULT size_t size() const
+    {
+        return m_size;
+    }
+
+    void mark_slot_changed( const size_t slot ) override
+    {
+        if( !m_slot_dirty[slot] )
+        {
+            m_slot_dirty[slot] = true;
+            m_dirty_slots.push_back( slot );
+        }
+    }
+
+protected:
+    UREACT_WARN_UNUSED_RESULT size_t capacity() const
+    {
+        return m_tree.size() / 2;
+    }
+
+    // Copy values of dirty members into their leaves
+    void refresh_dirty_leaves()
+    {
+        const size_t leaves_begin = capacity();
+        for( const size_t slot : m_dirty_slots )
+        {
+            const auto& tap = m_taps[slot];
+            m_tree[leaves_begin + slot] = tap ? tap->value_ref() : m_identity;
+        }
+    }
+
+    void clear_dirty_slots()
+    {
+        for( const size_t slot : m_dirty_slots )
+            m_slot_dirty[slot] = false;
+        m_dirty_slots.clear();
+        m_needs_rebuild = false;
+    }
+
+    S m_identity;
+    std::vector<S> m_tree;
+    std::vector<size_t> m_dirty_slots;
+    bool m_needs_rebuild = false;
+    bool m_is_level_raised = false;
+
+private:
+    // Double the number of leaves. Internal nodes are recalculated during the next update
+    void grow()
+    {
+        const size_t old_capacity = capacity();
+        const size_t new_capacity = old_capacity * 2;
+
+        std::vector<S> tree( new_capacity * 2, m_identity );
+        std::move( m_tree.begin() + old_capacity, m_tree.end(), tree.begin() + new_capacity );
+        m_tree = std::move( tree );
+
+        m_needs_rebuild = true;
+    }
+
+    std::vector<std::shared_ptr<slot_tap_node<S>>> m_taps;
+    std::vector<size_t> m_free_slots;
+    std::vector<bool> m_slot_dirty;
+    size_t m_size = 0;
+};
+
+template <typename S, typename Op>
+class reduce_signals_node_impl final : public reduce_signals_node<S>
+{
+public:
+    template <typename InOp>
+    reduce_signals_node_impl( const context& context, const S& identity, InOp&& op )
+        : reduce_signals_node_impl::reduce_signals_node( context, identity )
+        , m_op( std::forward<InOp>( op ) )
+    {}
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        // Topology has been changed, so successors are re-leveled before this node is updated
+        if( this->m_is_level_raised )
+        {
+            this->m_is_level_raised = false;
+            return update_result::shifted;
+        }
+
+        this->refresh_dirty_leaves();
+
+        std::vector<S>& tree = this->m_tree;
+        const size_t leaves_begin = this->capacity();
+
+        {
+            UREACT_CALLBACK_GUARD( this->get_graph() );
+
+            if( this->m_needs_rebuild )
+            {
+                for( size_t i = leaves_begin - 1; i >= 1; --i )
+                    combine_children( tree, i );
+            }
+            else
+            {
+                for( const size_t slot : this->m_dirty_slots )
+                    for( size_t i = ( leaves_begin + slot ) / 2; i >= 1; i /= 2 )
+                        combine_children( tree, i );
+            }
+        }
+
+        this->clear_dirty_slots();
+
+        const S& root = tree[1];
+        return this->try_change_value( root );
+    }
+
+private:
+    void combine_children( std::vector<S>& tree, const size_t i )
+    {
+        tree[i] = m_op( tree[2 * i], tree[2 * i + 1] );
+    }
+
+    Op m_op;
+};
+
+} // namespace detail
+
+/*!
+ * @brief Signal holding the reduction of a dynamic set of member signals
+ *
+ *  Members can be added and removed at runtime. The reduction is maintained incrementally
+ *  in a segment tree, so a change of a single member costs O(log N) operator calls
+ *  instead of recalculating the reduction over all N members.
+ *
+ *  Members are combined in order of their slots, and slots of removed members are reused,
+ *  so the operator should be commutative if members are removed.
+ */
+template <typename S>
+class reduced_signal : public signal<S>
+{
+public:
+    /*!
+     * @brief Identifier of a member within the set, valid until the member is removed
+     */
+    using member_id = size_t;
+
+    /*!
+     * @brief Default construct @ref reduced_signal
+     *
+     * Default constructed @ref reduced_signal is not attached to node, so it is not valid.
+     */
+    reduced_signal() = default;
+
+    /*!
+     * @brief Add a new member to the set
+     *
+     *  If add was called inside of a transaction function, the reduction is updated
+     *  when the transaction function returns.
+     */
+    member_id add( const signal<S>& member ) const
+    {
+        assert( this->is_valid() && "Can't add to reduced_signal not attached to a node" );
+        assert( !this->get_graph().is_locked() && "Can't add to reduced_signal from callback" );
+
+        const member_id id = get_reduce_node()->add( member );
+        this->get_graph().push_input( get_reduce_node()->get_node_id() );
+        return id;
+    }
+
+    /*!
+     * @brief Remove the member with the given id from the set
+     *
+     *  The id can be reused by following calls to add()
+     */
+    void remove( const member_id id ) const
+    {
+        assert( this->is_valid() && "Can't remove from reduced_signal not attached to a node" );
+        assert( !this->get_graph().is_locked()
+                && "Can't remove from reduced_signal from callback" );
+
+        get_reduce_node()->remove( id );
+        this->get_graph().push_input( get_reduce_node()->get_node_id() );
+    }
+
+    /*!
+     * @brief Return the number of members in the set
+     */
+    UREACT_WARN_UNUSED_RESULT size_t member_count() const
+    {
+        assert( this->is_valid() && "Can't get size of reduced_signal not attached to a node" );
+        return get_reduce_node()->size();
+    }
+
+protected:
+    using Node = detail::reduce_signals_node<S>;
+
+    /*!
+     * @brief Construct from the given node
+     */
+    explicit reduced_signal( std::shared_ptr<Node>&& node )
+        : reduced_signal::signal( std::move( node ) )
+    {}
+
+    template <typename Ret, typename Node, typename... Args>
+    friend Ret detail::create_wrapped_node( Args&&... args );
+
+private:
+    UREACT_WARN_UNUSED_RESULT Node* get_reduce_node() const
+    {
+        return static_cast<Node*>( this->get_node_ptr().get() );
+    }
+};
+
+/*!
+ * @brief Create a signal holding the reduction of a dynamic set of member signals
+ *
+ *  The signature of op should be equivalent to:
+ *  * S op(const S&, const S&)
+ *  op should be a function object, other invocables such as member pointers are not supported.
+ *
+ *  op should be associative and identity should be its identity element,
+ *  i.e. op(identity, v) == op(v, identity) == v. The reduction of the empty set is identity.
+ *  Members are added with @ref reduced_signal::add().
+ */
+template <typename S, typename InOp>
+UREACT_WARN_UNUSED_RESULT auto reduce_signals( const context& context, InOp&& op, S identity )
+    -> reduced_signal<S>
+{
+    using Op = std::decay_t<InOp>;
+
+    static_assert( std::is_invocable_r_v<S, Op&, const S&, const S&>,
+        "reduce_signals: Passed operator does not match the required signature" );
+
+    assert( !get_internals( context ).get_graph().is_locked()
+            && "Can't make reduced signal from callback" );
+
+    return detail::create_wrapped_node<reduced_signal<S>, detail::reduce_signals_node_impl<S, Op>>(
+        context, identity, std::forward<InOp>( op ) );
+}
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_REDUCED_SIGNAL_HPP
@@ -11,6 +11,8 @@
 #define UREACT_SIGNAL_HPP
 
 #include <cassert>
+#include <memory>
+#include <optional>
 
 #include <ureact/context.hpp>
 #include <ureact/detail/has_changed.hpp>
@@ -47,14 +49,55 @@ public:
     {
         if( has_changed( this->m_value, new_value ) )
         {
-            this->m_value = std::forward<T>( new_value );
+            this->assign_value( std::forward<T>( new_value ) );
             return update_result::changed;
         }
         return update_result::unchanged;
     }
 
+    // Start keeping the value the node had before its latest change
+    void keep_previous_value()
+    {
+        if( !m_previous_value )
+            m_previous_value = std::make_unique<S>( m_value );
+    }
+
+    UREACT_WARN_UNUSED_RESULT bool is_previous_value_kept() const
+    {
+        return m_previous_value != nullptr;
+    }
+
+    // Value before the latest change. Valid until finalize() of the turn the node has changed in
+    UREACT_WARN_UNUSED_RESULT const S& previous_value_ref() const
+    {
+        assert( m_previous_value != nullptr && "keep_previous_value() should be called first" );
+        return *m_previous_value;
+    }
+
 protected:
+    // Assign a new value. If previous value is kept, buffers are swapped, so no copy is made
+    template <class T>
+    void assign_value( T&& new_value )
+    {
+        if( m_previous_value )
+        {
+            using std::swap;
+            swap( *m_previous_value, m_value );
+        }
+        m_value = std::forward<T>( new_value );
+    }
+
+    // Should be called before in-place modification of m_value if previous value is kept
+    void save_previous_value()
+    {
+        if( m_previous_value )
+            *m_previous_value = m_value;
+    }
+
     S m_value;
+
+private:
+    std::unique_ptr<S> m_previous_value;
 };
 
 template <typename S>
@@ -64,7 +107,6 @@ public:
     template <typename T>
     explicit var_node( const context& context, T&& value )
         : var_node::signal_node( context, std::forward<T>( value ) )
-        , m_new_value( value )
     {}
 
     template <typename V>
@@ -72,9 +114,7 @@ public:
     {
         m_new_value = std::forward<V>( new_value );
 
-        m_is_input_added = true;
-
-        // m_is_input_added takes precedences over m_is_input_modified
+        // added input takes precedences over m_is_input_modified
         // the only difference between the two is that m_is_input_modified doesn't/can't compare
         m_is_input_modified = false;
     }
@@ -84,28 +124,87 @@ public:
     void modify_value( F& func )
     {
         // There hasn't been any set(...) input yet, modify.
-        if( !m_is_input_added )
+        if( !m_new_value.has_value() )
         {
-            func( this->m_value );
-
-            m_is_input_modified = true;
+            // Multiple modifications within a transaction change the value of a single turn
+            if( !m_is_input_modified )
+                this->save_previous_value();
+
+            if constexpr( std::is_same_v<std::invoke_result_t<F&, S&>, bool> )
+            {
+                // Modifier reports if value is changed. Reports within a transaction are combined
+                const bool changed = func( this->m_value );
+                m_is_input_modified = m_is_input_modified || changed;
+            }
+            else
+            {
+                func( this->m_value );
+
+                m_is_input_modified = true;
+            }
         }
         // There's a new_value, modify new_value instead.
         // The modified new_value will be handled like before, i.e. it'll be compared to m_value
         // in apply_input
         else
         {
-            func( m_new_value );
+            func( *m_new_value );
         }
     }
 
-    UREACT_WARN_UNUSED_RESULT update_result update() override
+    // Return if the node has to be queued as deferred input
+    template <typename V>
+    UREACT_WARN_UNUSED_RESULT bool set_value_deferred( V&& new_value )
     {
-        if( m_is_input_added )
+        const bool is_first = m_deferred_value == nullptr;
+        if( is_first )
+            m_deferred_value = std::make_unique<S>( std::forward<V>( new_value ) );
+        else
+            *m_deferred_value = std::forward<V>( new_value );
+        return is_first;
+    }
+
+    // Current value is used by nodes in the current turn, so a staged copy is modified instead
+    template <typename F>
+    UREACT_WARN_UNUSED_RESULT bool modify_value_deferred( F& func )
+    {
+        const bool is_first = m_deferred_value == nullptr;
+        if( is_first )
+            m_deferred_value = std::make_unique<S>( this->m_value );
+
+        if constexpr( std::is_same_v<std::invoke_result_t<F&, S&>, bool> )
         {
-            m_is_input_added = false;
+            // Modifier reports that the copy of the current value is unchanged, nothing to apply
+            const bool changed = func( *m_deferred_value );
+            if( is_first && !changed )
+            {
+                m_deferred_value.reset();
+                return false;
+            }
+        }
+        else
+        {
+            func( *m_deferred_value );
+        }
+        return is_first;
+    }
 
-            return this->try_change_value( std::move( m_new_value ) );
+    void apply_deferred_input() override
+    {
+        if( m_deferred_value )
+        {
+            set_value( std::move( *m_deferred_value ) );
+            m_deferred_value.reset();
+        }
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        if( m_new_value.has_value() )
+        {
+            const update_result result = this->try_change_value( std::move( *m_new_value ) );
+            m_new_value.reset();
+            return result;
         }
 
         if( m_is_input_modified )
@@ -119,11 +218,32 @@ public:
     }
 
 private:
-    S m_new_value;
-    bool m_is_input_added = false; // TODO: replace 2 bools with enum class
+    // Staging storage exists only while input is pending, so steady-state memory is one value
+    std::optional<S> m_new_value;
+
+    // Deferred input is rare, so it is kept out of line to not increase the size of each node
+    std::unique_ptr<S> m_deferred_value;
+
     bool m_is_input_modified = false;
 };
 
+template <typename S>
+class const_node final : public signal_node<S>
+{
+public:
+    template <typename T>
+    explicit const_node( const context& context, T&& value )
+        : const_node::signal_node( context, std::forward<T>( value ) )
+    {
+        this->mark_as_constant();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        return update_result::unchanged;
+    }
+};
+
 template <typename S>
 class signal_internals
 {
@@ -193,11 +313,29 @@ protected:
         graph_ref.push_input( node_ptr->get_node_id() );
     }
 
+    template <typename T>
+    void set_value_deferred( T&& new_value ) const
+    {
+        var_node<S>* node_ptr = get_var_node();
+        if( node_ptr->set_value_deferred( std::forward<T>( new_value ) ) )
+            get_graph().push_deferred_input( node_ptr->get_node_id() );
+    }
+
+    template <typename F>
+    void modify_value_deferred( const F& func ) const
+    {
+        var_node<S>* node_ptr = get_var_node();
+        if( node_ptr->modify_value_deferred( func ) )
+            get_graph().push_deferred_input( node_ptr->get_node_id() );
+    }
+
 private:
     UREACT_WARN_UNUSED_RESULT auto get_var_node() const
     {
         assert( m_node != nullptr && "Should be attached to a node" );
-        return dynamic_cast<var_node<S>*>( this->m_node.get() );
+        assert( dynamic_cast<var_node<S>*>( this->m_node.get() ) != nullptr
+                && "Should be attached to a var node" );
+        return static_cast<var_node<S>*>( this->m_node.get() );
     }
 
     std::shared_ptr<signal_node<S>> m_node;
@@ -387,21 +525,74 @@ public:
      * @brief Modify current signal value in-place
      *
      *  The signature of func should be equivalent to:
-     *  * void func(const S&)
+     *  * void func(S&)
+     *  * bool func(S&)
      *
      *  We can not compare the old and new values, we lose the ability to detect
-     *  whether the data was actually changed. We always have to assume that
-     *  it did and re-calculate dependent signals.
+     *  whether the data was actually changed. If func returns void, we always have to assume
+     *  that it did and re-calculate dependent signals. If func returns bool, it reports
+     *  whether the value was changed, so no-op modifications are not propagated.
+     *  Within a transaction, the value is considered changed if any modification reported so.
      */
     template <typename F>
     void modify( const F& func ) const
     {
-        static_assert(
-            std::is_invocable_r_v<void, F, S&>, "Modifier functions should be void(S&)" );
+        static_assert( std::is_invocable_r_v<void, F, S&>,
+            "Modifier functions should be void(S&) or bool(S&)" );
         assert( this->is_valid() && "Can't modify value of var_signal not attached to a node" );
         this->modify_value( func );
     }
 
+    /*!
+     * @brief Set new signal value in a follow-up turn
+     *
+     * Unlike set(), it can be called from callbacks, e.g. from observers, to make feedback loops.
+     * The new value is applied in a follow-up turn of the current propagation,
+     * or of the next one if there is no propagation in progress.
+     * Values set several times before the follow-up turn are collapsed into the last one.
+     *
+     * The number of follow-up turns within a single propagation is limited,
+     * see @ref context::set_max_deferred_turns()
+     */
+    void set_deferred( const S& new_value ) const
+    {
+        assert( this->is_valid() && "Can't set new value for var_signal not attached to a node" );
+        this->set_value_deferred( new_value );
+    }
+
+    /*!
+     * @brief Set new signal value in a follow-up turn
+     *
+     * Specialization of set_deferred(const S& new_value) for rvalue
+     */
+    void set_deferred( S&& new_value ) const
+    {
+        assert( this->is_valid() && "Can't set new value for var_signal not attached to a node" );
+        this->set_value_deferred( std::move( new_value ) );
+    }
+
+    /*!
+     * @brief Modify signal value in a follow-up turn
+     *
+     *  The signature of func should be equivalent to:
+     *  * void func(S&)
+     *  * bool func(S&)
+     *
+     *  Modification is applied to a copy of the current value, so unlike modify()
+     *  the result is compared with the current value and change is detected.
+     *  If func returns false for the first modification before the follow-up turn,
+     *  the copy is dropped and no follow-up turn is requested.
+     *  See set_deferred() for the details.
+     */
+    template <typename F>
+    void modify_deferred( const F& func ) const
+    {
+        static_assert( std::is_invocable_r_v<void, F, S&>,
+            "Modifier functions should be void(S&) or bool(S&)" );
+        assert( this->is_valid() && "Can't modify value of var_signal not attached to a node" );
+        this->modify_value_deferred( func );
+    }
+
     /*!
      * @brief Set new signal value
      *
@@ -434,8 +625,8 @@ public:
     template <typename F, class = std::enable_if_t<std::is_invocable_v<F, S&>>>
     void operator<<=( const F& func ) const
     {
-        static_assert(
-            std::is_invocable_r_v<void, F, S&>, "Modifier functions should be void(S&)" );
+        static_assert( std::is_invocable_r_v<void, F, S&>,
+            "Modifier functions should be void(S&) or bool(S&)" );
         assert( this->is_valid() && "Can't modify value of var_signal not attached to a node" );
         this->modify_value( func );
     }
@@ -616,14 +807,15 @@ UREACT_WARN_UNUSED_RESULT auto make_var( const context& context, V&& value )
  * @brief Create a new signal node and links it to the returned signal instance
  *
  *  Returned value doesn't have input interface and can be used a placeholder where signal is required.
- *  Currently it's just cosmetic function that can be expressed as signal{ make_var(context, value) }
- *  but it can be optimized in future.
+ *  The node is constant: it is never scheduled and nodes depending on it don't attach to it.
+ *  Signals calculated only from constants with lift() are constant as well.
  */
 template <typename V, typename S = std::decay_t<V>>
 UREACT_WARN_UNUSED_RESULT auto make_const( const context& context, V&& value ) -> signal<S>
 {
     assert( !get_internals( context ).get_graph().is_locked() && "Can't make const from callback" );
-    return make_var_impl( context, std::forward<V>( value ) );
+    return detail::create_wrapped_node<signal<S>, detail::const_node<S>>(
+        context, std::forward<V>( value ) );
 }
 
 namespace default_context
@@ -0,0 +1,390 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_SIGNAL_ARRAY_HPP
+#define UREACT_SIGNAL_ARRAY_HPP
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <ureact/context.hpp>
+#include <ureact/detail/has_changed.hpp>
+#include <ureact/detail/node_base.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+/// Node holding a contiguous array of values and indices of elements changed in the current turn
+template <typename T>
+class signal_array_node : public node_base
+{
+public:
+    signal_array_node( const context& context, std::vector<T>&& values )
+        : node_base( context )
+        , m_values( std::move( values ) )
+        , m_dirty_mask( ( m_values.size() + 63 ) / 64 )
+    {}
+
+    UREACT_WARN_UNUSED_RESULT const std::vector<T>& values_ref() const
+    {
+        return m_values;
+    }
+
+    /// Indices of elements changed in the current turn, in order of change
+    UREACT_WARN_UNUSED_RESULT const std::vector<size_t>& dirty_indices() const
+    {
+        return m_dirty;
+    }
+
+    void finalize() override
+    {
+        for( const size_t index : m_dirty )
+            m_dirty_mask[index / 64] = 0;
+        m_dirty.clear();
+    }
+
+protected:
+    // Assign a new element value if is differed and mark it as dirty
+    template <typename V>
+    void try_change_element( const size_t index, V&& new_value )
+    {
+        const T& current_value = m_values[index];
+        if( has_changed( current_value, static_cast<const T&>( new_value ) ) )
+        {
+            m_values[index] = std::forward<V>( new_value );
+            mark_dirty( index );
+        }
+    }
+
+    void mark_dirty( const size_t index )
+    {
+        if( set_mask_bit( index ) )
+            m_dirty.push_back( index );
+    }
+
+    // The mask is clear between turns, so it can be used to track elements with pending input.
+    // Return if the bit wasn't set before
+    UREACT_WARN_UNUSED_RESULT bool set_mask_bit( const size_t index )
+    {
+        const std::uint64_t bit = std::uint64_t( 1 ) << ( index % 64 );
+        std::uint64_t& word = m_dirty_mask[index / 64];
+        if( ( word & bit ) != 0 )
+            return false;
+        word |= bit;
+        return true;
+    }
+
+    void reset_mask_bit( const size_t index )
+    {
+        m_dirty_mask[index / 64] &= ~( std::uint64_t( 1 ) << ( index % 64 ) );
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result dirty_result() const
+    {
+        return m_dirty.empty() ? update_result::unchanged : update_result::changed;
+    }
+
+    std::vector<T> m_values;
+
+private:
+    std::vector<size_t> m_dirty;
+    std::vector<std::uint64_t> m_dirty_mask;
+};
+
+template <typename T>
+class var_array_node final : public signal_array_node<T>
+{
+public:
+    var_array_node( const context& context, std::vector<T>&& values )
+        : var_array_node::signal_array_node( context, std::move( values ) )
+        , m_pending_slots( this->m_values.size() )
+    {}
+
+    /// Return if the node has to be pushed as input
+    template <typename V>
+    UREACT_WARN_UNUSED_RESULT bool set_element( const size_t index, V&& new_value )
+    {
+        assert( index < this->m_values.size() && "Index is out of range" );
+        const bool is_first = m_new_values.empty();
+
+        // Element already has pending input, the last one wins
+        if( !this->set_mask_bit( index ) )
+        {
+            m_new_values[m_pending_slots[index]].second = std::forward<V>( new_value );
+            return is_first;
+        }
+
+        m_pending_slots[index] = m_new_values.size();
+        m_new_values.emplace_back( index, std::forward<V>( new_value ) );
+        return is_first;
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        // Bits of pending input are cleared first, so the mask can track dirty elements again
+        for( const auto& new_value : m_new_values )
+            this->reset_mask_bit( new_value.first );
+
+        // Only the last value of each element is compared with its current value
+        for( auto& [index, new_value] : m_new_values )
+            this->try_change_element( index, std::move( new_value ) );
+        m_new_values.clear();
+
+        return this->dirty_result();
+    }
+
+private:
+    std::vector<std::pair<size_t, T>> m_new_values;
+
+    // Position of pending input in m_new_values. Valid while the mask bit of the element is set
+    std::vector<size_t> m_pending_slots;
+};
+
+template <typename T>
+class signal_array_internals
+{
+public:
+    signal_array_internals() = default;
+
+    template <typename Node>
+    explicit signal_array_internals( std::shared_ptr<Node>&& node )
+        : m_node( std::move( node ) )
+    {}
+
+    UREACT_WARN_UNUSED_RESULT std::shared_ptr<signal_array_node<T>>& get_node_ptr()
+    {
+        return m_node;
+    }
+
+    UREACT_WARN_UNUSED_RESULT const std::shared_ptr<signal_array_node<T>>& get_node_ptr() const
+    {
+        return m_node;
+    }
+
+    UREACT_WARN_UNUSED_RESULT node_id get_node_id() const
+    {
+        assert( m_node != nullptr && "Should be attached to a node" );
+        return m_node->get_node_id();
+    }
+
+    UREACT_WARN_UNUSED_RESULT const std::vector<T>& get_values() const
+    {
+        assert( m_node != nullptr && "Should be attached to a node" );
+        assert( !get_graph().is_locked() && "Can't read signal array value from callback" );
+        return m_node->values_ref();
+    }
+
+protected:
+    UREACT_WARN_UNUSED_RESULT react_graph& get_graph() const
+    {
+        assert( m_node != nullptr && "Should be attached to a node" );
+        return get_internals( m_node->get_context() ).get_graph();
+    }
+
+    template <typename V>
+    void set_element( const size_t index, V&& new_value ) const
+    {
+        react_graph& graph_ref = get_graph();
+        assert( !graph_ref.is_locked() && "Can't set signal array value from callback" );
+
+        assert( dynamic_cast<var_array_node<T>*>( m_node.get() ) != nullptr
+                && "Should be attached to a var array node" );
+        auto* node_ptr = static_cast<var_array_node<T>*>( m_node.get() );
+        if( node_ptr->set_element( index, std::forward<V>( new_value ) ) )
+            graph_ref.push_input( node_ptr->get_node_id() );
+    }
+
+private:
+    std::shared_ptr<signal_array_node<T>> m_node;
+};
+
+} // namespace detail
+
+/*!
+ * @brief Fixed size array of homogeneous values held by a single reactive node
+ *
+ *  Unlike a collection of separate signals, the whole array is a single node, so changing
+ *  any number of its elements costs a single scheduler operation. Changes are tracked
+ *  per element, so dependent arrays and observers process only changed elements.
+ *
+ *  Copy, move and assignment semantics are similar to std::shared_ptr.
+ */
+template <typename T>
+class signal_array : protected detail::signal_array_internals<T>
+{
+public:
+    /*!
+     * @brief Alias to element type to use in metaprogramming
+     */
+    using value_t = T;
+
+    /*!
+     * @brief Default construct @ref signal_array
+     *
+     * Default constructed @ref signal_array is not attached to node, so it is not valid
+     */
+    signal_array() = default;
+
+    /*!
+     * @brief Return @ref context used by attached node
+     */
+    UREACT_WARN_UNUSED_RESULT const context& get_context() const
+    {
+        return this->get_node_ptr()->get_context();
+    }
+
+    /*!
+     * @brief Tests if this instance is linked to a node
+     */
+    UREACT_WARN_UNUSED_RESULT bool is_valid() const
+    {
+        return this->get_node_ptr() != nullptr;
+    }
+
+    /*!
+     * @brief Return the number of elements
+     */
+    UREACT_WARN_UNUSED_RESULT size_t size() const
+    {
+        assert( this->is_valid() && "Can't get size of signal_array not attached to a node" );
+        return this->get_node_ptr()->values_ref().size();
+    }
+
+    /*!
+     * @brief Return value of the element with the given index
+     */
+    UREACT_WARN_UNUSED_RESULT typename std::vector<T>::const_reference get(
+        const size_t index ) const
+    {
+        assert( this->is_valid() && "Can't get value of signal_array not attached to a node" );
+        return this->get_values()[index];
+    }
+
+    /*!
+     * @brief Return values of all elements
+     */
+    UREACT_WARN_UNUSED_RESULT const std::vector<T>& values() const
+    {
+        assert( this->is_valid() && "Can't get value of signal_array not attached to a node" );
+        return this->get_values();
+    }
+
+    /*!
+     * @brief Return internals. Not intended to use in user code
+     */
+    UREACT_WARN_UNUSED_RESULT friend detail::signal_array_internals<T>& get_internals(
+        signal_array<T>& s )
+    {
+        return s;
+    }
+
+    /*!
+     * @brief Return internals. Not intended to use in user code
+     */
+    UREACT_WARN_UNUSED_RESULT friend const detail::signal_array_internals<T>& get_internals(
+        const signal_array<T>& s )
+    {
+        return s;
+    }
+
+protected:
+    using Node = detail::signal_array_node<T>;
+
+    /*!
+     * @brief Construct from the given node
+     */
+    explicit signal_array( std::shared_ptr<Node>&& node )
+        : signal_array::signal_array_internals( std::move( node ) )
+    {}
+
+    template <typename Ret, typename Node, typename... Args>
+    friend Ret detail::create_wrapped_node( Args&&... args );
+};
+
+/*!
+ * @brief Fixed size array of homogeneous input values held by a single reactive node
+ *
+ *  Elements set within a transaction are propagated in a single turn.
+ */
+template <typename T>
+class var_signal_array : public signal_array<T>
+{
+public:
+    /*!
+     * @brief Default construct @ref var_signal_array
+     *
+     * Default constructed @ref var_signal_array is not attached to node, so it is not valid
+     */
+    var_signal_array() = default;
+
+    /*!
+     * @brief Set new value of the element with the given index
+     *
+     *  If the old value equals the new value, the call has no effect.
+     */
+    void set( const size_t index, const T& new_value ) const
+    {
+        assert( this->is_valid() && "Can't set value of signal_array not attached to a node" );
+        this->set_element( index, new_value );
+    }
+
+    /*!
+     * @brief Set new value of the element with the given index
+     *
+     *  Specialization of set(size_t index, const T& new_value) for rvalue
+     */
+    void set( const size_t index, T&& new_value ) const
+    {
+        assert( this->is_valid() && "Can't set value of signal_array not attached to a node" );
+        this->set_element( index, std::move( new_value ) );
+    }
+
+protected:
+    using Node = detail::var_array_node<T>;
+
+    /*!
+     * @brief Construct from the given node
+     */
+    explicit var_signal_array( std::shared_ptr<Node>&& node )
+        : var_signal_array::signal_array( std::move( node ) )
+    {}
+
+    template <typename Ret, typename Node, typename... Args>
+    friend Ret detail::create_wrapped_node( Args&&... args );
+};
+
+/*!
+ * @brief Create a new input signal array node with the given values
+ */
+template <typename T>
+UREACT_WARN_UNUSED_RESULT auto make_var_array( const context& context, std::vector<T> values )
+    -> var_signal_array<T>
+{
+    assert( !get_internals( context ).get_graph().is_locked()
+            && "Can't make var array from callback" );
+    return detail::create_wrapped_node<var_signal_array<T>, detail::var_array_node<T>>(
+        context, std::move( values ) );
+}
+
+/*!
+ * @brief Create a new input signal array node with count copies of value
+ */
+template <typename T>
+UREACT_WARN_UNUSED_RESULT auto make_var_array(
+    const context& context, const size_t count, const T& value ) -> var_signal_array<T>
+{
+    return make_var_array( context, std::vector<T>( count, value ) );
+}
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_SIGNAL_ARRAY_HPP
@@ -0,0 +1,335 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_STRUCT_SIGNAL_HPP
+#define UREACT_STRUCT_SIGNAL_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <ureact/context.hpp>
+#include <ureact/detail/has_changed.hpp>
+#include <ureact/signal.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+template <typename M>
+struct member_pointer_traits;
+
+template <typename C, typename F>
+struct member_pointer_traits<F C::*>
+{
+    using class_t = C;
+    using field_t = F;
+};
+
+template <auto Member>
+using struct_field_t = typename member_pointer_traits<decltype( Member )>::field_t;
+
+/// Mask with all fields of a struct marked as changed
+inline constexpr std::uint64_t all_struct_fields = ~std::uint64_t( 0 );
+
+/// Assign the next free bit of the change mask of T. Fields beyond the 63rd share the last bit
+template <typename T>
+UREACT_WARN_UNUSED_RESULT std::uint64_t next_struct_field_mask()
+{
+    static std::atomic<unsigned> next_bit{ 0 };
+    const unsigned bit = next_bit.fetch_add( 1, std::memory_order_relaxed );
+    return std::uint64_t( 1 ) << ( bit < 63 ? bit : 63 );
+}
+
+/// Bit of the change mask of a struct corresponding to the given field
+template <auto Member>
+UREACT_WARN_UNUSED_RESULT std::uint64_t struct_field_mask()
+{
+    using class_t = typename member_pointer_traits<decltype( Member )>::class_t;
+    static const std::uint64_t mask = next_struct_field_mask<class_t>();
+    return mask;
+}
+
+/// Signal node holding a struct and the mask of its fields changed in the current turn
+template <typename T>
+class struct_node : public signal_node<T>
+{
+public:
+    template <typename V>
+    struct_node( const context& context, V&& value )
+        : struct_node::signal_node( context, std::forward<V>( value ) )
+    {}
+
+    UREACT_WARN_UNUSED_RESULT std::uint64_t changed_fields() const
+    {
+        return m_changed_fields;
+    }
+
+    void finalize() override
+    {
+        m_changed_fields = 0;
+    }
+
+protected:
+    std::uint64_t m_changed_fields = 0;
+};
+
+template <typename T>
+class var_struct_node final : public struct_node<T>
+{
+public:
+    template <typename V>
+    var_struct_node( const context& context, V&& value )
+        : var_struct_node::struct_node( context, std::forward<V>( value ) )
+    {}
+
+    template <typename V>
+    void set_value( V&& new_value )
+    {
+        m_new_value = std::forward<V>( new_value );
+    }
+
+    // Fields are modified in place, like in var_node::modify_value()
+    template <auto Member>
+    void set_field( struct_field_t<Member>&& new_value )
+    {
+        // There's a new_value, modify new_value instead. It will be compared as a whole
+        if( m_new_value.has_value() )
+        {
+            ( *m_new_value ).*Member = std::move( new_value );
+            return;
+        }
+
+        auto& field = this->m_value.*Member;
+        if( has_changed( field, new_value ) )
+        {
+            // Multiple modifications within a transaction change the value of a single turn
+            if( m_pending_fields == 0 )
+                this->save_previous_value();
+
+            field = std::move( new_value );
+            m_pending_fields |= struct_field_mask<Member>();
+        }
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        if( m_new_value.has_value() )
+        {
+            const update_result result = this->try_change_value( std::move( *m_new_value ) );
+            m_new_value.reset();
+            m_pending_fields = 0;
+
+            if( result == update_result::changed )
+                this->m_changed_fields = all_struct_fields;
+            return result;
+        }
+
+        if( m_pending_fields != 0 )
+        {
+            this->m_changed_fields = m_pending_fields;
+            m_pending_fields = 0;
+            return update_result::changed;
+        }
+
+        return update_result::unchanged;
+    }
+
+private:
+    std::optional<T> m_new_value;
+    std::uint64_t m_pending_fields = 0;
+};
+
+/// Projection of a single field of a struct, evaluated only if the field is marked as changed
+template <typename T, auto Member>
+class struct_field_node final : public signal_node<struct_field_t<Member>>
+{
+public:
+    struct_field_node( const context& context, const std::shared_ptr<struct_node<T>>& source )
+        : struct_field_node::signal_node( context, source->value_ref().*Member )
+        , m_source( source )
+        , m_mask( struct_field_mask<Member>() )
+    {
+        this->attach_to( m_source->get_node_id() );
+    }
+
+    ~struct_field_node() override
+    {
+        this->detach_from_all();
+    }
+
+    UREACT_WARN_UNUSED_RESULT update_result update() override
+    {
+        if( ( m_source->changed_fields() & m_mask ) == 0 )
+            return update_result::unchanged;
+
+        return this->try_change_value( m_source->value_ref().*Member );
+    }
+
+private:
+    std::shared_ptr<struct_node<T>> m_source;
+    std::uint64_t m_mask;
+};
+
+} // namespace detail
+
+/*!
+ * @brief Signal holding a struct, that tracks which of its fields have changed
+ *
+ *  Projections of fields created with field() are updated only if their field has changed,
+ *  so a single node can feed consumers of separate fields instead of a node per field,
+ *  while consumers of a field don't pay for changes of the other fields.
+ *
+ *  Each field gets its own bit in a 64-bit change mask. Fields of a struct beyond
+ *  the 63rd share the last bit, so their projections only have to compare values.
+ */
+template <typename T>
+class struct_signal : public signal<T>
+{
+public:
+    /*!
+     * @brief Default construct @ref struct_signal
+     *
+     * Default constructed @ref struct_signal is not attached to node, so it is not valid.
+     */
+    struct_signal() = default;
+
+    /*!
+     * @brief Create a signal holding the value of the given field
+     *
+     *  Usage: s.field<&T::member>()
+     */
+    template <auto Member>
+    UREACT_WARN_UNUSED_RESULT auto field() const
+    {
+        using traits = detail::member_pointer_traits<decltype( Member )>;
+        static_assert( std::is_same_v<typename traits::class_t, T>,
+            "struct_signal: Member should be a pointer to data member of T" );
+        static_assert( !std::is_function_v<typename traits::field_t>,
+            "struct_signal: Member should be a pointer to data member of T" );
+
+        assert( this->is_valid() && "Can't project struct_signal not attached to a node" );
+
+        using F = typename traits::field_t;
+        return detail::create_wrapped_node<signal<F>, detail::struct_field_node<T, Member>>(
+            this->get_context(), get_struct_node() );
+    }
+
+protected:
+    using Node = detail::struct_node<T>;
+
+    /*!
+     * @brief Construct from the given node
+     */
+    explicit struct_signal( std::shared_ptr<Node>&& node )
+        : struct_signal::signal( std::move( node ) )
+    {}
+
+    UREACT_WARN_UNUSED_RESULT std::shared_ptr<Node> get_struct_node() const
+    {
+        return std::static_pointer_cast<Node>( this->get_node_ptr() );
+    }
+
+    template <typename Ret, typename Node, typename... Args>
+    friend Ret detail::create_wrapped_node( Args&&... args );
+};
+
+/*!
+ * @brief Input @ref struct_signal that can be modified field by field
+ */
+template <typename T>
+class var_struct_signal : public struct_signal<T>
+{
+public:
+    /*!
+     * @brief Default construct @ref var_struct_signal
+     *
+     * Default constructed @ref var_struct_signal is not attached to node, so it is not valid.
+     */
+    var_struct_signal() = default;
+
+    /*!
+     * @brief Set new value of the whole struct. All fields are considered changed
+     *
+     *  If the old value equals the new value, the call has no effect.
+     */
+    void set( T new_value ) const
+    {
+        assert( this->is_valid() && "Can't set value of var_struct_signal not attached to a node" );
+        assert( !this->get_graph().is_locked() && "Can't set signal value from callback" );
+
+        auto* node_ptr = get_var_struct_node();
+        node_ptr->set_value( std::move( new_value ) );
+        this->get_graph().push_input( node_ptr->get_node_id() );
+    }
+
+    /*!
+     * @brief Set new value of the given field
+     *
+     *  Usage: s.set_field<&T::member>(value)
+     *
+     *  Only projections of this field are updated.
+     *  If the old value of the field equals the new value, the call has no effect.
+     */
+    template <auto Member>
+    void set_field( detail::struct_field_t<Member> new_value ) const
+    {
+        static_assert(
+            std::is_same_v<typename detail::member_pointer_traits<decltype( Member )>::class_t, T>,
+            "var_struct_signal: Member should be a pointer to data member of T" );
+
+        assert( this->is_valid() && "Can't set value of var_struct_signal not attached to a node" );
+        assert( !this->get_graph().is_locked() && "Can't set signal value from callback" );
+
+        auto* node_ptr = get_var_struct_node();
+        node_ptr->template set_field<Member>( std::move( new_value ) );
+        this->get_graph().push_input( node_ptr->get_node_id() );
+    }
+
+protected:
+    using Node = detail::var_struct_node<T>;
+
+    /*!
+     * @brief Construct from the given node
+     */
+    explicit var_struct_signal( std::shared_ptr<Node>&& node )
+        : var_struct_signal::struct_signal( std::move( node ) )
+    {}
+
+    template <typename Ret, typename Node, typename... Args>
+    friend Ret detail::create_wrapped_node( Args&&... args );
+
+private:
+    UREACT_WARN_UNUSED_RESULT Node* get_var_struct_node() const
+    {
+        return static_cast<Node*>( this->get_node_ptr().get() );
+    }
+};
+
+/*!
+ * @brief Create a new input struct signal node with the given value
+ */
+template <typename V, typename T = std::decay_t<V>>
+UREACT_WARN_UNUSED_RESULT auto make_var_struct( const context& context, V&& value )
+    -> var_struct_signal<T>
+{
+    static_assert( std::is_class_v<T>, "make_var_struct: value should be of class type" );
+
+    assert( !get_internals( context ).get_graph().is_locked()
+            && "Can't make var struct from callback" );
+    return detail::create_wrapped_node<var_struct_signal<T>, detail::var_struct_node<T>>(
+        context, std::forward<V>( value ) );
+}
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_STRUCT_SIGNAL_HPP
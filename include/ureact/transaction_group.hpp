@@ -0,0 +1,76 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_TRANSACTION_GROUP_HPP
+#define UREACT_TRANSACTION_GROUP_HPP
+
+#include <initializer_list>
+#include <vector>
+
+#include <ureact/context.hpp>
+#include <ureact/detail/defines.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+/*!
+ * @brief Guard class to start and finish transactions in several contexts together
+ *
+ *  Transactions are started in all contexts on construction, so inputs of all contexts
+ *  are gathered before any of them is propagated. On finish, contexts are propagated
+ *  one after another in the given order, or concurrently with finish_parallel().
+ *
+ *  It is not an atomic commit: callbacks of a context see the new values of its own
+ *  reactives, while following contexts still hold the old ones. Inputs set from
+ *  callbacks of one context into a following context of the group are propagated
+ *  as part of its transaction.
+ */
+class UREACT_API UREACT_WARN_UNUSED_RESULT transaction_group
+{
+public:
+    explicit transaction_group( std::initializer_list<context> contexts );
+    explicit transaction_group( std::vector<context> contexts );
+    ~transaction_group();
+
+    /*!
+     * @brief Finish transaction before code scope is ended. Contexts are propagated in order
+     *
+     *  If a callback throws, the following contexts are still propagated
+     *  and the first exception is rethrown after all of them.
+     */
+    void finish();
+
+    /*!
+     * @brief Finish transaction propagating each context in a separate thread
+     *
+     *  Contexts should be independent, i.e. callbacks of one context should not access
+     *  reactives of another context of the group. Each context is still propagated
+     *  by a single thread, so callbacks may create nodes and contexts.
+     *  If a callback throws, the first exception is rethrown after all contexts are propagated.
+     *
+     *  Uses std::thread, so the application should link a thread library,
+     *  e.g. Threads::Threads in CMake.
+     */
+    void finish_parallel();
+
+private:
+    void finish_impl();
+
+    UREACT_MAKE_NONCOPYABLE( transaction_group );
+    UREACT_MAKE_NONMOVABLE( transaction_group );
+
+    std::vector<context> m_contexts;
+    bool m_finished = false;
+};
+
+UREACT_END_NAMESPACE
+
+#if UREACT_HEADER_ONLY
+#    include <ureact/detail/transaction_group.inl>
+#endif
+
+#endif // UREACT_TRANSACTION_GROUP_HPP
@@ -0,0 +1,142 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_UTILITY_ASYNC_DISPATCHER_HPP
+#define UREACT_UTILITY_ASYNC_DISPATCHER_HPP
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <ureact/context.hpp>
+#include <ureact/detail/defines.hpp>
+#include <ureact/transaction.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+/// Thread-safe list of completed asynchronous computations waiting to be applied
+class async_completion_queue
+{
+public:
+    /// Returns if the result was applied or dropped as outdated
+    using completion_t = std::function<bool()>;
+
+    void push( completion_t completion )
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_completions.push_back( std::move( completion ) );
+    }
+
+    UREACT_WARN_UNUSED_RESULT std::vector<completion_t> take_all()
+    {
+        std::vector<completion_t> result;
+        std::lock_guard<std::mutex> lock( m_mutex );
+        std::swap( result, m_completions );
+        return result;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<completion_t> m_completions;
+};
+
+} // namespace detail
+
+/*!
+ * @brief Connects asynchronous nodes of a context with an executor
+ *
+ *  Jobs of asynchronous nodes are passed to the executor and are run on its threads.
+ *  Their results are collected in a thread-safe list and are published
+ *  by process_completed() that should be called on the thread owning the context,
+ *  for example in the event loop.
+ *
+ *  Copies share the same list of completed results.
+ */
+class async_dispatcher
+{
+public:
+    using job_t = std::function<void()>;
+
+    /*!
+     * @brief Type of executor. It should run the job on some thread, now or later
+     */
+    using executor_t = std::function<void( job_t )>;
+
+    /*!
+     * @brief Construct dispatcher passing jobs to the given executor, such as a thread pool
+     *
+     *  The executor owns the threads the jobs are run on, so it is responsible for
+     *  bounding their number and for finishing or dropping jobs before it is destroyed.
+     */
+    async_dispatcher( context ctx, executor_t executor )
+        : m_context( std::move( ctx ) )
+        , m_executor( std::move( executor ) )
+        , m_completed( std::make_shared<detail::async_completion_queue>() )
+    {}
+
+    /*!
+     * @brief Publish results of completed jobs in a single transaction
+     *
+     *  Results of jobs superseded by newer requests are dropped.
+     *  Returns the number of published results.
+     */
+    size_t process_completed()
+    {
+        std::vector<detail::async_completion_queue::completion_t> completions
+            = m_completed->take_all();
+
+        if( completions.empty() )
+            return 0;
+
+        size_t published = 0;
+        transaction _{ m_context };
+        for( auto& completion : completions )
+            if( completion() )
+                ++published;
+        return published;
+    }
+
+    /*!
+     * @brief Return the context which nodes are served by the dispatcher
+     */
+    UREACT_WARN_UNUSED_RESULT const context& get_context() const
+    {
+        return m_context;
+    }
+
+    /*!
+     * @brief Pass the job to the executor. Not intended to use in user code
+     */
+    void submit( job_t job ) const
+    {
+        m_executor( std::move( job ) );
+    }
+
+    /*!
+     * @brief Return list of completed results. Not intended to use in user code
+     */
+    UREACT_WARN_UNUSED_RESULT const std::shared_ptr<detail::async_completion_queue>&
+    get_completion_queue() const
+    {
+        return m_completed;
+    }
+
+private:
+    context m_context;
+    executor_t m_executor;
+    std::shared_ptr<detail::async_completion_queue> m_completed;
+};
+
+UREACT_END_NAMESPACE
+
+#endif //UREACT_UTILITY_ASYNC_DISPATCHER_HPP
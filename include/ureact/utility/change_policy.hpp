@@ -0,0 +1,88 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_UTILITY_CHANGE_POLICY_HPP
+#define UREACT_UTILITY_CHANGE_POLICY_HPP
+
+#include <ureact/detail/defines.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+/*!
+ * @brief Predefined change detection policies
+ *
+ *  Change detection policy is a function object with signature equivalent to:
+ *  * bool policy(const S& current_value, const S& new_value)
+ *
+ *  It returns true if new_value should replace current value and be propagated further.
+ *  Any such function object can be used as a custom comparator.
+ */
+namespace change_policy
+{
+
+/*!
+ * @brief Each new value is considered changed
+ *
+ *  Useful if values are cheap to recalculate, but expensive to compare
+ */
+struct always_t
+{
+    template <typename T>
+    UREACT_WARN_UNUSED_RESULT constexpr bool operator()( const T&, const T& ) const noexcept
+    {
+        return true;
+    }
+};
+
+/*!
+ * @brief No new value is considered changed, so the initial value is kept
+ */
+struct never_t
+{
+    template <typename T>
+    UREACT_WARN_UNUSED_RESULT constexpr bool operator()( const T&, const T& ) const noexcept
+    {
+        return false;
+    }
+};
+
+/*!
+ * @brief New value is considered changed if it differs from current value more than by epsilon
+ *
+ *  New value is compared with the last propagated value, so slow drift is not lost.
+ *  Transitions to and from NaN are considered changed.
+ */
+template <typename T>
+struct tolerance_t
+{
+    T epsilon;
+
+    UREACT_WARN_UNUSED_RESULT constexpr bool operator()( const T& lhs, const T& rhs ) const
+    {
+        return !( lhs - rhs <= epsilon && rhs - lhs <= epsilon );
+    }
+};
+
+inline constexpr always_t always{};
+
+inline constexpr never_t never{};
+
+/*!
+ * @brief Create @ref tolerance_t policy with the given epsilon
+ */
+template <typename T>
+UREACT_WARN_UNUSED_RESULT constexpr tolerance_t<T> tolerance( T epsilon )
+{
+    return tolerance_t<T>{ epsilon };
+}
+
+} // namespace change_policy
+
+UREACT_END_NAMESPACE
+
+#endif //UREACT_UTILITY_CHANGE_POLICY_HPP
@@ -0,0 +1,128 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_UTILITY_HISTORY_WINDOW_HPP
+#define UREACT_UTILITY_HISTORY_WINDOW_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <ureact/detail/defines.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+/*!
+ * @brief Fixed capacity window of the last N values, ordered from the oldest to the newest
+ *
+ *  Values are stored inline in a ring of 2N slots, where each value is written twice,
+ *  at positions i and i + N. This way the window is always contiguous in memory,
+ *  so data() can be passed to functions expecting a plain array, and pushing a new value
+ *  never allocates.
+ */
+template <typename T, std::size_t N>
+class history_window
+{
+    static_assert( N >= 1, "history_window: capacity should be at least 1" );
+    static_assert( std::is_default_constructible_v<T>,
+        "history_window: value type should be default constructible" );
+
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    /*!
+     * @brief Append a new value, dropping the oldest one if the window is full
+     */
+    template <typename V>
+    void push( V&& value )
+    {
+        m_storage[m_next + N] = value;
+        m_storage[m_next] = std::forward<V>( value );
+
+        m_next = m_next + 1 == N ? 0 : m_next + 1;
+        if( m_size < N )
+            ++m_size;
+    }
+
+    /*!
+     * @brief Return pointer to the contiguous range of values, the oldest value first
+     */
+    UREACT_WARN_UNUSED_RESULT const T* data() const
+    {
+        return m_storage.data() + m_next + N - m_size;
+    }
+
+    UREACT_WARN_UNUSED_RESULT std::size_t size() const
+    {
+        return m_size;
+    }
+
+    UREACT_WARN_UNUSED_RESULT static constexpr std::size_t capacity()
+    {
+        return N;
+    }
+
+    UREACT_WARN_UNUSED_RESULT bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    UREACT_WARN_UNUSED_RESULT bool full() const
+    {
+        return m_size == N;
+    }
+
+    /*!
+     * @brief Return value with the given index, where 0 is the oldest value
+     */
+    UREACT_WARN_UNUSED_RESULT const T& operator[]( const std::size_t index ) const
+    {
+        assert( index < m_size );
+        return data()[index];
+    }
+
+    /*!
+     * @brief Return the oldest value
+     */
+    UREACT_WARN_UNUSED_RESULT const T& front() const
+    {
+        assert( !empty() );
+        return data()[0];
+    }
+
+    /*!
+     * @brief Return the newest value
+     */
+    UREACT_WARN_UNUSED_RESULT const T& back() const
+    {
+        assert( !empty() );
+        return data()[m_size - 1];
+    }
+
+    UREACT_WARN_UNUSED_RESULT const_iterator begin() const
+    {
+        return data();
+    }
+
+    UREACT_WARN_UNUSED_RESULT const_iterator end() const
+    {
+        return data() + m_size;
+    }
+
+private:
+    std::array<T, 2 * N> m_storage{};
+    std::size_t m_next = 0;
+    std::size_t m_size = 0;
+};
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_UTILITY_HISTORY_WINDOW_HPP
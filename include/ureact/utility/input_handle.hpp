@@ -0,0 +1,161 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_UTILITY_INPUT_HANDLE_HPP
+#define UREACT_UTILITY_INPUT_HANDLE_HPP
+
+#include <cassert>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <ureact/context.hpp>
+#include <ureact/signal.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+/// Same as @ref transaction, but holds the graph instead of a copy of the context
+class UREACT_WARN_UNUSED_RESULT graph_transaction_guard
+{
+public:
+    explicit graph_transaction_guard( react_graph& graph )
+        : m_graph( graph )
+    {
+        m_graph.start_transaction();
+    }
+
+    ~graph_transaction_guard()
+    {
+        m_graph.finish_transaction();
+    }
+
+private:
+    UREACT_MAKE_NONCOPYABLE( graph_transaction_guard );
+    UREACT_MAKE_NONMOVABLE( graph_transaction_guard );
+
+    react_graph& m_graph;
+};
+
+} // namespace detail
+
+/*!
+ * @brief Handle to set values of a var_signal with node and graph resolved in advance
+ *
+ *  var_signal::set() resolves the node and the graph of its context on each call.
+ *  input_handle does it once on construction, so setting a value is just staging it
+ *  in the node and scheduling the node. It keeps the var_signal alive.
+ *
+ *  Use @ref set_many() to set values of several handles in a single turn.
+ */
+template <typename S>
+class input_handle
+{
+public:
+    /*!
+     * @brief Default construct @ref input_handle
+     *
+     * Default constructed @ref input_handle is not attached to node, so it is not valid.
+     */
+    input_handle() = default;
+
+    /*!
+     * @brief Construct from the given var_signal
+     */
+    explicit input_handle( const var_signal<S>& var )
+        : m_var( var )
+    {
+        assert( m_var.is_valid() && "Can't create input_handle from invalid var_signal" );
+
+        m_node = static_cast<detail::var_node<S>*>( get_internals( m_var ).get_node_ptr().get() );
+        m_graph = &get_internals( m_node->get_context() ).get_graph();
+    }
+
+    /*!
+     * @brief Tests if this instance is linked to a node
+     */
+    UREACT_WARN_UNUSED_RESULT bool is_valid() const
+    {
+        return m_node != nullptr;
+    }
+
+    /*!
+     * @brief Return the var_signal this handle is created from
+     */
+    UREACT_WARN_UNUSED_RESULT const var_signal<S>& get_var() const
+    {
+        return m_var;
+    }
+
+    /*!
+     * @brief Set new signal value. Equivalent to var_signal::set()
+     */
+    template <typename V>
+    void set( V&& new_value ) const
+    {
+        assert( is_valid() && "Can't set new value for input_handle not attached to a node" );
+        assert( !m_graph->is_locked() && "Can't set signal value from callback" );
+
+        m_node->set_value( std::forward<V>( new_value ) );
+        m_graph->push_input( m_node->get_node_id() );
+    }
+
+    template <typename Handles, typename Values>
+    friend void set_many( const Handles& handles, Values&& values );
+
+private:
+    var_signal<S> m_var;
+    detail::var_node<S>* m_node = nullptr;
+    detail::react_graph* m_graph = nullptr;
+};
+
+/*!
+ * @brief Set values of several input handles and propagate all changes in a single turn
+ *
+ *  handles and values are sized ranges of the same size, where values[i] is set to handles[i].
+ *  All handles should belong to the same context.
+ *  If values is an rvalue, its elements are moved.
+ *
+ *  Nodes are scheduled directly in the graph inside a single transaction,
+ *  so no context is copied and no memory is allocated per call.
+ */
+template <typename Handles, typename Values>
+void set_many( const Handles& handles, Values&& values )
+{
+    assert( std::size( handles ) == std::size( values ) && "Sizes of ranges should be equal" );
+
+    if( std::size( handles ) == 0 )
+        return;
+
+    detail::react_graph* graph = std::begin( handles )->m_graph;
+    assert( !graph->is_locked() && "Can't set signal value from callback" );
+
+    // Transaction is finished even if setting a value throws
+    detail::graph_transaction_guard _{ *graph };
+
+    auto value_it = std::begin( values );
+    for( const auto& handle : handles )
+    {
+        assert( handle.is_valid() && "Can't set new value for invalid input_handle" );
+        assert( handle.m_graph == graph && "All handles should belong to the same context" );
+
+        if constexpr( std::is_lvalue_reference_v<Values> )
+            handle.m_node->set_value( *value_it );
+        else
+            handle.m_node->set_value( std::move( *value_it ) );
+        ++value_it;
+
+        graph->push_input( handle.m_node->get_node_id() );
+    }
+}
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_UTILITY_INPUT_HANDLE_HPP
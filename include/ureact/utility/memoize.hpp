@@ -0,0 +1,175 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_UTILITY_MEMOIZE_HPP
+#define UREACT_UTILITY_MEMOIZE_HPP
+
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ureact/detail/defines.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+/*!
+ * @brief Default hasher of @ref memoized function arguments
+ *
+ *  Combines std::hash of each argument.
+ */
+struct memo_hash
+{
+    template <typename... Args>
+    UREACT_WARN_UNUSED_RESULT size_t operator()( const Args&... args ) const
+    {
+        // boost::hash_combine
+        size_t seed = 0;
+        ( ( seed ^= std::hash<Args>{}( args ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 ) ),
+            ... );
+        return seed;
+    }
+};
+
+/*!
+ * @brief Pure function with a bounded cache of its results
+ *
+ *  The cache is direct-mapped: each set of arguments has a single slot chosen by its hash,
+ *  so lookup is a hash calculation and a comparison of the arguments with the ones stored
+ *  in the slot. A miss replaces the slot content.
+ *
+ *  Copies share the same cache and counters, so a copy passed to lift or another adaptor
+ *  can be inspected via the original object.
+ */
+template <typename F, typename Hasher, typename... Args>
+class memoized
+{
+public:
+    /*!
+     * @brief Type of the function result
+     */
+    using result_t = std::decay_t<std::invoke_result_t<F&, const Args&...>>;
+
+    /*!
+     * @brief Construct from the given function, cache capacity and hasher
+     */
+    template <typename InF, typename InHasher>
+    memoized( InF&& func, const size_t capacity, InHasher&& hasher )
+        : m_state( std::make_shared<state>(
+            std::forward<InF>( func ), capacity, std::forward<InHasher>( hasher ) ) )
+    {
+        assert( capacity > 0 && "memoized: capacity should be greater than zero" );
+    }
+
+    /*!
+     * @brief Return cached result for the given arguments or calculate it
+     */
+    UREACT_WARN_UNUSED_RESULT const result_t& operator()( const Args&... args ) const
+    {
+        state& s = *m_state;
+
+        const size_t index = std::invoke( s.hasher, args... ) % s.entries.size();
+        std::optional<entry>& slot = s.entries[index];
+
+        if( slot.has_value() && slot->first == std::tie( args... ) )
+        {
+            ++s.hits;
+            return slot->second;
+        }
+
+        ++s.misses;
+        slot.emplace( std::tuple<Args...>{ args... }, std::invoke( s.func, args... ) );
+        return slot->second;
+    }
+
+    /*!
+     * @brief Return the number of calls that returned cached result
+     */
+    UREACT_WARN_UNUSED_RESULT size_t hits() const
+    {
+        return m_state->hits;
+    }
+
+    /*!
+     * @brief Return the number of calls that calculated result
+     */
+    UREACT_WARN_UNUSED_RESULT size_t misses() const
+    {
+        return m_state->misses;
+    }
+
+    /*!
+     * @brief Return the max number of cached results
+     */
+    UREACT_WARN_UNUSED_RESULT size_t capacity() const
+    {
+        return m_state->entries.size();
+    }
+
+    /*!
+     * @brief Drop cached results, counters stay intact
+     */
+    void clear() const
+    {
+        for( std::optional<entry>& slot : m_state->entries )
+            slot.reset();
+    }
+
+private:
+    using entry = std::pair<std::tuple<Args...>, result_t>;
+
+    struct state
+    {
+        template <typename InF, typename InHasher>
+        state( InF&& func, const size_t capacity, InHasher&& hasher )
+            : func( std::forward<InF>( func ) )
+            , hasher( std::forward<InHasher>( hasher ) )
+            , entries( capacity )
+        {}
+
+        F func;
+        Hasher hasher;
+        std::vector<std::optional<entry>> entries;
+        size_t hits = 0;
+        size_t misses = 0;
+    };
+
+    std::shared_ptr<state> m_state;
+};
+
+/*!
+ * @brief Create a @ref memoized function with the given cache capacity and hasher
+ *
+ *  Argument types Args... have to be specified explicitly.
+ *
+ *  The signature of hasher should be equivalent to:
+ *  * size_t hasher(const Args&...)
+ */
+template <typename... Args, typename InF, typename InHasher>
+UREACT_WARN_UNUSED_RESULT auto memoize( InF&& func, const size_t capacity, InHasher&& hasher )
+{
+    return memoized<std::decay_t<InF>, std::decay_t<InHasher>, Args...>{
+        std::forward<InF>( func ), capacity, std::forward<InHasher>( hasher ) };
+}
+
+/*!
+ * @brief Create a @ref memoized function with the given cache capacity using @ref memo_hash
+ */
+template <typename... Args, typename InF>
+UREACT_WARN_UNUSED_RESULT auto memoize( InF&& func, const size_t capacity = 16 )
+{
+    return memoize<Args...>( std::forward<InF>( func ), capacity, memo_hash{} );
+}
+
+UREACT_END_NAMESPACE
+
+#endif //UREACT_UTILITY_MEMOIZE_HPP
@@ -0,0 +1,156 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_UTILITY_RESERVING_BUILDER_HPP
+#define UREACT_UTILITY_RESERVING_BUILDER_HPP
+
+#include <cassert>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <ureact/context.hpp>
+#include <ureact/detail/defines.hpp>
+#include <ureact/signal.hpp>
+#include <ureact/utility/type_traits.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+/*!
+ * @brief Builder of a reactive subgraph that reserves node slots of the context in bulk
+ *
+ *  Holds a builder function that creates a subgraph from the given input signals.
+ *  The first instantiation measures how many nodes the subgraph consists of,
+ *  so instantiate_n() can reserve node slots of the context once for all instances
+ *  instead of growing the slot storage while nodes are created one by one.
+ *
+ *  It is not a prototype of the subgraph: instances are built by calling the builder
+ *  function each time, exactly as if it was called directly. Only the bookkeeping slots
+ *  of the graph are reserved. Node objects are not stored contiguously, each node is still
+ *  a separate allocation, and each node owns its own copy of its functor. To avoid copying
+ *  a heavy functor into every instance, capture it by reference in the builder
+ *  and pass it wrapped into std::cref().
+ */
+template <typename F, typename... Inputs>
+class reserving_builder final
+{
+public:
+    /*!
+     * @brief Type returned by the builder function
+     */
+    using result_t = std::invoke_result_t<const F&, const signal<Inputs>&...>;
+
+    /*!
+     * @brief Construct from the given builder function
+     */
+    template <typename InF, class = detail::disable_if_same_t<InF, reserving_builder>>
+    explicit reserving_builder( InF&& builder )
+        : m_builder( std::forward<InF>( builder ) )
+    {}
+
+    /*!
+     * @brief Create a new instance of the subgraph using the given signals as inputs
+     *
+     *  The first call measures the number of nodes a single instance consists of.
+     */
+    UREACT_WARN_UNUSED_RESULT result_t instantiate( const signal<Inputs>&... inputs )
+    {
+        static_assert(
+            sizeof...( Inputs ) > 0, "reserving_builder: at least one input is required" );
+
+        const context& ctx = std::get<0>( std::tie( inputs... ) ).get_context();
+        const detail::react_graph& graph = get_internals( ctx ).get_graph();
+
+        const size_t node_count_before = graph.node_count();
+        result_t result = m_builder( inputs... );
+
+        if( m_nodes_per_instance == 0 )
+        {
+            const size_t node_count_after = graph.node_count();
+            assert( node_count_after >= node_count_before );
+            m_nodes_per_instance = node_count_after - node_count_before;
+        }
+
+        return result;
+    }
+
+    /*!
+     * @brief Create count instances of the subgraph
+     *
+     *  The signature of input_generator should be equivalent to:
+     *  * std::tuple<signal<Inputs>...> input_generator(size_t index)
+     *
+     *  All instances should belong to the same context.
+     *  Node slots for the remaining instances are reserved right after the first one is created.
+     */
+    template <typename InputGenerator>
+    UREACT_WARN_UNUSED_RESULT std::vector<result_t> instantiate_n(
+        const size_t count, InputGenerator&& input_generator )
+    {
+        std::vector<result_t> instances;
+        instances.reserve( count );
+
+        for( size_t i = 0; i < count; ++i )
+        {
+            const auto inputs = input_generator( i );
+            instances.push_back( std::apply(
+                [this]( const auto&... args ) { return instantiate( args... ); }, inputs ) );
+
+            // The size of the subgraph is known after the first instantiation
+            if( i == 0 )
+                reserve( std::get<0>( inputs ).get_context(), count - 1 );
+        }
+
+        return instances;
+    }
+
+    /*!
+     * @brief Reserve node slots of the context for count more instances of the subgraph
+     *
+     *  Only the slot storage of the graph is reserved, nodes themselves are allocated
+     *  on instantiation. Does nothing until the size of the subgraph is known,
+     *  i.e. before the first instantiation.
+     */
+    void reserve( context ctx, const size_t count ) const
+    {
+        detail::react_graph& graph = get_internals( ctx ).get_graph();
+        graph.reserve_nodes( graph.node_count() + count * m_nodes_per_instance );
+    }
+
+    /*!
+     * @brief Return the number of nodes a single instance consists of
+     *
+     *  The value is 0 until the first instantiation
+     */
+    UREACT_WARN_UNUSED_RESULT size_t nodes_per_instance() const
+    {
+        return m_nodes_per_instance;
+    }
+
+private:
+    F m_builder;
+    size_t m_nodes_per_instance = 0;
+};
+
+/*!
+ * @brief Create a @ref reserving_builder from the given builder function
+ *
+ *  Input value types Inputs... have to be specified explicitly.
+ *
+ *  The signature of builder should be equivalent to:
+ *  * Result builder(const signal<Inputs>&...)
+ */
+template <typename... Inputs, typename InF>
+UREACT_WARN_UNUSED_RESULT auto make_reserving_builder( InF&& builder )
+{
+    return reserving_builder<std::decay_t<InF>, Inputs...>{ std::forward<InF>( builder ) };
+}
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_UTILITY_RESERVING_BUILDER_HPP
@@ -0,0 +1,228 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_UTILITY_SNAPSHOT_READER_HPP
+#define UREACT_UTILITY_SNAPSHOT_READER_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <ureact/detail/defines.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+namespace detail
+{
+
+/*!
+ * @brief Set of slots holding published values, written by a single thread and read by any
+ *
+ *  The writer fills a slot that is neither the current one nor used by readers
+ *  and then makes it current. Readers mark the current slot as used and check
+ *  that it is still current before reading it, so the writer never writes a slot
+ *  while it is read and readers never see partially written values.
+ *  Neither side waits for the other. If all slots except the current one are used
+ *  by readers, the writer allocates a new slot, so publication never fails.
+ *  Slots are never freed while the buffer is alive, so their number is bounded
+ *  by the maximal number of simultaneous reads plus two.
+ */
+template <typename... Values>
+class snapshot_buffer
+{
+    struct slot
+    {
+        std::optional<std::tuple<Values...>> values;
+        std::uint64_t version = 0;
+        std::atomic<unsigned> readers{ 0 };
+    };
+
+public:
+    explicit snapshot_buffer( const size_t slot_count )
+    {
+        assert( slot_count >= 2 && "snapshot_buffer: at least 2 slots are required" );
+
+        m_slots.reserve( slot_count );
+        for( size_t i = 0; i < slot_count; ++i )
+            m_slots.push_back( std::make_unique<slot>() );
+    }
+
+    /// Should be called by the writer thread only
+    template <typename... Refs>
+    void publish( const Refs&... values )
+    {
+        slot& s = free_slot();
+
+        // Storage of the previous publication is reused if possible
+        if( s.values.has_value() )
+            *s.values = std::tie( values... );
+        else
+            s.values.emplace( values... );
+        s.version = ++m_version;
+
+        m_current.store( &s );
+    }
+
+    /// Return the number of allocated slots. Should be called by the writer thread only
+    UREACT_WARN_UNUSED_RESULT size_t slot_count() const
+    {
+        return m_slots.size();
+    }
+
+    UREACT_WARN_UNUSED_RESULT bool has_value() const
+    {
+        return m_current.load() != nullptr;
+    }
+
+    template <typename F>
+    decltype( auto ) read( F&& func ) const
+    {
+        for( ;; )
+        {
+            slot* s = m_current.load();
+            assert( s != nullptr && "snapshot_buffer: nothing is published yet" );
+
+            s->readers.fetch_add( 1 );
+
+            // The slot could be chosen by the writer before it was marked as used
+            if( m_current.load() == s )
+            {
+                const read_guard guard{ *s };
+                const std::tuple<Values...>& values = *s->values;
+                return std::invoke( std::forward<F>( func ), s->version, values );
+            }
+
+            s->readers.fetch_sub( 1 );
+        }
+    }
+
+private:
+    struct read_guard
+    {
+        slot& s;
+
+        ~read_guard()
+        {
+            s.readers.fetch_sub( 1 );
+        }
+    };
+
+    slot& free_slot()
+    {
+        const slot* current = m_current.load();
+        for( const std::unique_ptr<slot>& s : m_slots )
+            if( s.get() != current && s->readers.load() == 0 )
+                return *s;
+
+        // Readers see only the current slot, so they are not affected by reallocation
+        m_slots.push_back( std::make_unique<slot>() );
+        return *m_slots.back();
+    }
+
+    std::vector<std::unique_ptr<slot>> m_slots;
+    std::atomic<slot*> m_current{ nullptr };
+    std::uint64_t m_version = 0;
+};
+
+} // namespace detail
+
+/*!
+ * @brief Thread-safe reader of values published by @ref publish at the end of turns
+ *
+ *  Values of all published signals are read as of the same turn. Reading never blocks
+ *  propagation and is never blocked by it. Copies share the same storage, so a reader
+ *  can be created by the graph thread and copied into reader threads.
+ *
+ *  Published values are stored in a few slots. A slot is held by a reader for the duration
+ *  of read(), and if readers hold all slots except the current one, the writer allocates
+ *  one more slot, so each turn is published. Allocated slots are kept until the reader
+ *  and all its copies are destroyed, so their number is bounded by the maximal number
+ *  of simultaneous reads plus two.
+ *
+ *  Only a single publisher can write into a reader.
+ */
+template <typename... Values>
+class snapshot_reader
+{
+public:
+    /*!
+     * @brief Construct reader with the given number of preallocated slots, at least 2
+     */
+    explicit snapshot_reader( const size_t slot_count = 3 )
+        : m_buffer( std::make_shared<detail::snapshot_buffer<Values...>>( slot_count ) )
+    {}
+
+    /*!
+     * @brief Return if any values were published
+     */
+    UREACT_WARN_UNUSED_RESULT bool has_value() const
+    {
+        return m_buffer->has_value();
+    }
+
+    /*!
+     * @brief Call func with the latest published values and return its result
+     *
+     *  The signature of func should be equivalent to:
+     *  * Ret func(const Values&...)
+     *
+     *  Values are valid only during the call.
+     */
+    template <typename F>
+    decltype( auto ) read( F&& func ) const
+    {
+        assert( has_value() && "snapshot_reader: nothing is published yet" );
+        return m_buffer->read( [&func]( std::uint64_t, const std::tuple<Values...>& values ) //
+            -> decltype( auto ) { return std::apply( std::forward<F>( func ), values ); } );
+    }
+
+    /*!
+     * @brief Return copy of the latest published values
+     */
+    UREACT_WARN_UNUSED_RESULT std::tuple<Values...> get() const
+    {
+        assert( has_value() && "snapshot_reader: nothing is published yet" );
+        return m_buffer->read( []( std::uint64_t, const std::tuple<Values...>& values ) { //
+            return values;
+        } );
+    }
+
+    /*!
+     * @brief Return the number of the latest publication, starting from 1
+     */
+    UREACT_WARN_UNUSED_RESULT std::uint64_t version() const
+    {
+        if( !has_value() )
+            return 0;
+        return m_buffer->read( []( const std::uint64_t version, const auto& ) { //
+            return version;
+        } );
+    }
+
+    /*!
+     * @brief Return internal buffer. Not intended to use in user code
+     */
+    UREACT_WARN_UNUSED_RESULT const std::shared_ptr<detail::snapshot_buffer<Values...>>&
+    get_buffer() const
+    {
+        return m_buffer;
+    }
+
+private:
+    std::shared_ptr<detail::snapshot_buffer<Values...>> m_buffer;
+};
+
+UREACT_END_NAMESPACE
+
+#endif // UREACT_UTILITY_SNAPSHOT_READER_HPP
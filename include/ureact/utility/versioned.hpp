@@ -0,0 +1,133 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UREACT_UTILITY_VERSIONED_HPP
+#define UREACT_UTILITY_VERSIONED_HPP
+
+#include <cstdint>
+#include <utility>
+
+#include <ureact/detail/defines.hpp>
+#include <ureact/utility/type_traits.hpp>
+
+UREACT_BEGIN_NAMESPACE
+
+/*!
+ * @brief Value with a version stamp that is used for O(1) change detection
+ *
+ *  Signals of big values (vectors, maps, strings) either compare whole values on each change
+ *  or, if values are not comparable, are assumed always changed. Wrapping such a value
+ *  into versioned makes has_changed compare only version stamps.
+ *
+ *  Stamp is provided by the producer: it can be a monotonic version that is bumped on each
+ *  modification via set() and modify(), or a content hash passed to the constructor.
+ *  Values with the same stamp are considered equal regardless of their content.
+ */
+template <typename T>
+class versioned
+{
+public:
+    using value_type = T;
+    using version_type = std::uint64_t;
+
+    /*!
+     * @brief Default construct value with version 0
+     */
+    versioned() = default;
+
+    /*!
+     * @brief Construct from the given value and version stamp
+     */
+    template <typename V, class = detail::disable_if_same_t<V, versioned>>
+    explicit versioned( V&& value, version_type version = 0 )
+        : m_value( std::forward<V>( value ) )
+        , m_version( version )
+    {}
+
+    /*!
+     * @brief Return the stored value
+     */
+    UREACT_WARN_UNUSED_RESULT const T& get() const
+    {
+        return m_value;
+    }
+
+    /*!
+     * @brief Return the stored value
+     */
+    UREACT_WARN_UNUSED_RESULT const T& operator*() const
+    {
+        return m_value;
+    }
+
+    /*!
+     * @brief Access members of the stored value
+     */
+    UREACT_WARN_UNUSED_RESULT const T* operator->() const
+    {
+        return &m_value;
+    }
+
+    /*!
+     * @brief Return the version stamp
+     */
+    UREACT_WARN_UNUSED_RESULT version_type version() const
+    {
+        return m_version;
+    }
+
+    /*!
+     * @brief Replace the stored value and bump the version
+     */
+    template <typename V>
+    void set( V&& value )
+    {
+        m_value = std::forward<V>( value );
+        ++m_version;
+    }
+
+    /*!
+     * @brief Modify the stored value in-place and bump the version
+     *
+     *  The signature of func should be equivalent to:
+     *  * void func(T&)
+     */
+    template <typename F>
+    void modify( F&& func )
+    {
+        std::forward<F>( func )( m_value );
+        ++m_version;
+    }
+
+    /*!
+     * @brief Compare only version stamps in O(1)
+     */
+    UREACT_WARN_UNUSED_RESULT friend constexpr bool has_changed(
+        const versioned& lhs, const versioned& rhs ) noexcept
+    {
+        return lhs.m_version != rhs.m_version;
+    }
+
+private:
+    T m_value{};
+    version_type m_version = 0;
+};
+
+/*!
+ * @brief Create a @ref versioned value with the given version stamp
+ */
+template <typename V>
+UREACT_WARN_UNUSED_RESULT auto make_versioned(
+    V&& value, typename versioned<std::decay_t<V>>::version_type version = 0 )
+{
+    return versioned<std::decay_t<V>>{ std::forward<V>( value ), version };
+}
+
+UREACT_END_NAMESPACE
+
+#endif //UREACT_UTILITY_VERSIONED_HPP
@@ -0,0 +1,175 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/async_lift.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/signal.hpp"
+
+namespace
+{
+
+// Executor that runs jobs only when requested
+struct manual_executor
+{
+    void operator()( ureact::async_dispatcher::job_t job )
+    {
+        jobs.push_back( std::move( job ) );
+    }
+
+    void run_all()
+    {
+        std::vector<ureact::async_dispatcher::job_t> to_run;
+        std::swap( to_run, jobs );
+        for( auto& job : to_run )
+            job();
+    }
+
+    std::vector<ureact::async_dispatcher::job_t> jobs;
+};
+
+} // namespace
+
+TEST_CASE( "ureact::async_lift" )
+{
+    ureact::context ctx;
+
+    manual_executor executor;
+    ureact::async_dispatcher dispatcher{ ctx, std::ref( executor ) };
+
+    auto src = ureact::make_var( ctx, 1 );
+    auto fast = src + 1;
+
+    ureact::signal<int> slow;
+
+    const auto times_ten = []( int x ) { return x * 10; };
+
+    SECTION( "Functional syntax" )
+    {
+        slow = ureact::async_lift( src, dispatcher, times_ten );
+    }
+    SECTION( "Piped syntax" )
+    {
+        slow = src | ureact::async_lift( dispatcher, times_ten );
+    }
+
+    // initial value is calculated synchronously
+    CHECK( slow.get() == 10 );
+
+    src <<= 2;
+
+    // fast part of the graph is updated immediately, slow keeps its last value
+    CHECK( fast.get() == 3 );
+    CHECK( slow.get() == 10 );
+    CHECK( executor.jobs.size() == 1 );
+
+    // result is published only by the dispatcher
+    executor.run_all();
+    CHECK( slow.get() == 10 );
+
+    CHECK( dispatcher.process_completed() == 1 );
+    CHECK( slow.get() == 20 );
+
+    CHECK( dispatcher.process_completed() == 0 );
+}
+
+// Newer changes supersede pending computations
+TEST_CASE( "ureact::async_lift (supersede)" )
+{
+    ureact::context ctx;
+
+    manual_executor executor;
+    ureact::async_dispatcher dispatcher{ ctx, std::ref( executor ) };
+
+    auto a = ureact::make_var( ctx, 1 );
+    auto b = ureact::make_var( ctx, 1 );
+
+    int calls = 0;
+    auto sum = ureact::async_lift( with( a, b ), dispatcher, [&]( int lhs, int rhs ) {
+        ++calls;
+        return lhs + rhs;
+    } );
+
+    calls = 0;
+
+    // jobs that haven't started are skipped
+    a <<= 2;
+    b <<= 3;
+    executor.run_all();
+
+    CHECK( calls == 1 );
+    CHECK( dispatcher.process_completed() == 1 );
+    CHECK( sum.get() == 5 );
+
+    // results of jobs that were running are dropped
+    a <<= 10;
+    executor.run_all();
+    a <<= 20;
+
+    CHECK( dispatcher.process_completed() == 0 );
+    CHECK( sum.get() == 5 );
+
+    executor.run_all();
+
+    CHECK( dispatcher.process_completed() == 1 );
+    CHECK( sum.get() == 23 );
+}
+
+// Results of jobs finished after the signal is destroyed are dropped
+TEST_CASE( "ureact::async_lift (destroyed before completion)" )
+{
+    ureact::context ctx;
+
+    manual_executor executor;
+    ureact::async_dispatcher dispatcher{ ctx, std::ref( executor ) };
+
+    auto src = ureact::make_var( ctx, 1 );
+
+    {
+        auto slow = ureact::async_lift( src, dispatcher, []( int x ) { return x * 2; } );
+        src <<= 2;
+    }
+
+    executor.run_all();
+
+    CHECK( dispatcher.process_completed() == 0 );
+}
+
+TEST_CASE( "ureact::async_lift (worker thread)" )
+{
+    ureact::context ctx;
+
+    std::vector<std::thread> threads;
+    ureact::async_dispatcher dispatcher{ ctx, [&threads]( ureact::async_dispatcher::job_t job ) {
+                                            threads.emplace_back( std::move( job ) );
+                                        } };
+
+    auto src = ureact::make_var( ctx, 1 );
+    auto slow = ureact::async_lift( src, dispatcher, []( int x ) {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        return x * 2;
+    } );
+
+    src <<= 21;
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 10 );
+    while( slow.get() != 42 && std::chrono::steady_clock::now() < deadline )
+    {
+        std::ignore = dispatcher.process_completed();
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    CHECK( slow.get() == 42 );
+
+    for( std::thread& thread : threads )
+        thread.join();
+}
@@ -0,0 +1,84 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/detect_changes.hpp"
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/collect.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/monitor.hpp"
+
+// Per-signal change detection policy
+TEST_CASE( "ureact::detect_changes" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var( ctx, 0.0 );
+
+    SECTION( "tolerance" )
+    {
+        ureact::signal<double> filtered;
+
+        SECTION( "Functional syntax" )
+        {
+            filtered = ureact::detect_changes( src, ureact::change_policy::tolerance( 0.1 ) );
+        }
+        SECTION( "Piped syntax" )
+        {
+            filtered = src | ureact::detect_changes( ureact::change_policy::tolerance( 0.1 ) );
+        }
+        SECTION( "temp_signal" )
+        {
+            filtered = ureact::lift( src, []( double v ) { return v; } )
+                     | ureact::detect_changes( ureact::change_policy::tolerance( 0.1 ) );
+        }
+
+        auto values = ureact::collect<std::vector>( ureact::monitor( filtered ) );
+
+        // jitter is suppressed, but slow drift is detected
+        for( double v : { 0.05, -0.05, 0.08, 0.15, 0.2, 0.3 } )
+            src <<= v;
+
+        CHECK( values.get() == std::vector{ 0.15, 0.3 } );
+    }
+
+    SECTION( "always" )
+    {
+        auto same = ureact::make_var( ctx, 1 );
+        auto always = ureact::detect_changes( same, ureact::change_policy::always );
+        auto values = ureact::collect<std::vector>( ureact::monitor( always ) );
+
+        // var_signal itself detects lack of change, so use modify
+        same.modify( []( int& ) {} );
+        same.modify( []( int& ) {} );
+
+        CHECK( values.get() == std::vector{ 1, 1 } );
+    }
+
+    SECTION( "never" )
+    {
+        auto never = ureact::detect_changes( src, ureact::change_policy::never );
+        auto values = ureact::collect<std::vector>( ureact::monitor( never ) );
+
+        src <<= 1.0;
+
+        CHECK( never.get() == 0.0 );
+        CHECK( values.get().empty() );
+    }
+
+    SECTION( "custom comparator" )
+    {
+        auto src_int = ureact::make_var( ctx, 0 );
+        auto only_growing = ureact::detect_changes(
+            src_int, []( int current, int next ) { return next > current; } );
+
+        for( int v : { 1, 3, 2, 0, 4 } )
+            src_int <<= v;
+
+        CHECK( only_growing.get() == 4 );
+    }
+}
@@ -0,0 +1,85 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/gate.hpp"
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/count.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/monitor.hpp"
+#include "ureact/transaction.hpp"
+
+// Suspend propagation of a signal while gate is closed
+TEST_CASE( "ureact::gate" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var( ctx, 1 );
+    auto active = ureact::make_var( ctx, true );
+    ureact::signal<int> gated;
+
+    SECTION( "Functional syntax" )
+    {
+        gated = ureact::gate( src, active );
+    }
+    SECTION( "Piped syntax" )
+    {
+        gated = src | ureact::gate( active );
+    }
+
+    int calls = 0;
+    const auto squared = ureact::lift( gated, [&]( int value ) {
+        ++calls;
+        return value * value;
+    } );
+    const auto changes = ureact::count( ureact::monitor( squared ) );
+
+    CHECK( squared.get() == 1 );
+    CHECK( calls == 1 );
+
+    src <<= 2;
+    CHECK( squared.get() == 4 );
+    CHECK( calls == 2 );
+
+    // subgraph behind the gate is not updated while it is closed
+    active <<= false;
+    for( int i : { 3, 4, 5 } )
+        src <<= i;
+    CHECK( gated.get() == 2 );
+    CHECK( squared.get() == 4 );
+    CHECK( calls == 2 );
+
+    // value is refreshed once on resume
+    active <<= true;
+    CHECK( gated.get() == 5 );
+    CHECK( squared.get() == 25 );
+    CHECK( calls == 3 );
+
+    // no changes while suspended, so resume doesn't trigger recalculation
+    active <<= false;
+    active <<= true;
+    CHECK( calls == 3 );
+
+    // changes that are reverted while suspended are not noticed
+    active <<= false;
+    src <<= 6;
+    src <<= 5;
+    active <<= true;
+    CHECK( calls == 3 );
+
+    // changes in the same transaction as resume are propagated once
+    {
+        ureact::transaction _{ ctx };
+        active <<= false;
+        src <<= 7;
+        active <<= true;
+    }
+    CHECK( squared.get() == 49 );
+    CHECK( calls == 4 );
+
+    CHECK( changes.get() == 3 );
+}
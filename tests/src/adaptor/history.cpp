@@ -0,0 +1,87 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/history.hpp"
+
+#include <numeric>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+
+namespace
+{
+
+template <typename T, size_t N>
+std::vector<T> to_vector( const ureact::history_window<T, N>& window )
+{
+    return std::vector<T>( window.begin(), window.end() );
+}
+
+} // namespace
+
+TEST_CASE( "ureact::history_window" )
+{
+    ureact::history_window<int, 3> window;
+    CHECK( window.empty() );
+    CHECK( window.capacity() == 3 );
+
+    std::vector<std::vector<int>> windows;
+    for( int i = 1; i <= 7; ++i )
+    {
+        window.push( i );
+        windows.push_back( to_vector( window ) );
+
+        // Values are contiguous in memory
+        CHECK( window.data() + window.size() == window.end() );
+        CHECK( window.back() == i );
+    }
+
+    CHECK( window.full() );
+    CHECK( window.front() == 5 );
+    CHECK( window[1] == 6 );
+
+    CHECK( windows
+           == std::vector<std::vector<int>>{
+               { 1 },
+               { 1, 2 },
+               { 1, 2, 3 },
+               { 2, 3, 4 },
+               { 3, 4, 5 },
+               { 4, 5, 6 },
+               { 5, 6, 7 },
+           } );
+}
+
+TEST_CASE( "ureact::history" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var( ctx, 1 );
+    ureact::signal<ureact::history_window<int, 3>> last_values = src | ureact::history<3>;
+
+    CHECK( to_vector( last_values.get() ) == std::vector<int>{ 1 } );
+
+    // Moving average
+    auto average = ureact::lift( last_values, []( const ureact::history_window<int, 3>& w ) {
+        return std::accumulate( w.begin(), w.end(), 0 ) / static_cast<int>( w.size() );
+    } );
+
+    src <<= 2;
+    CHECK( to_vector( last_values.get() ) == std::vector<int>{ 1, 2 } );
+
+    // Unchanged values are not recorded
+    src <<= 2;
+    CHECK( to_vector( last_values.get() ) == std::vector<int>{ 1, 2 } );
+
+    src <<= 6;
+    CHECK( average.get() == 3 );
+
+    src <<= 7;
+    CHECK( to_vector( last_values.get() ) == std::vector<int>{ 2, 6, 7 } );
+    CHECK( average.get() == 5 );
+}
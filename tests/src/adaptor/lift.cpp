@@ -439,19 +439,19 @@ TEST_CASE( "CopyStatsForSignalCalculations" )
     auto d = ureact::make_var( ctx, copy_counter{ 1000, &stats } );
 
     // 4x move to m_value
-    // 4x copy to m_new_value (can't be uninitialized for references)
-    CHECK( stats.copy_count == 4 );
+    // no copies, because staging storage for new values is created only on input
+    CHECK( stats.copy_count == 0 );
     CHECK( stats.move_count == 4 );
 
     auto x = a + b + c + d;
 
-    CHECK( stats.copy_count == 4 );
+    CHECK( stats.copy_count == 0 );
     CHECK( stats.move_count == 7 );
     CHECK( x.get().v == 1111 );
 
     a <<= copy_counter{ 2, &stats };
 
-    CHECK( stats.copy_count == 4 );
+    CHECK( stats.copy_count == 0 );
     CHECK( stats.move_count == 10 );
     CHECK( x.get().v == 1112 );
 }
@@ -0,0 +1,89 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/lift_elements.hpp"
+
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/observe_elements.hpp"
+#include "ureact/signal_array.hpp"
+#include "ureact/transaction.hpp"
+
+TEST_CASE( "ureact::lift_elements" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var_array( ctx, std::vector{ -2, -1, 0, 1, 2 } );
+
+    const auto square = []( const int i ) { return i * i; };
+
+    ureact::signal_array<int> squared;
+
+    SECTION( "Functional syntax" )
+    {
+        squared = ureact::lift_elements( src, square );
+    }
+    SECTION( "Piped syntax" )
+    {
+        squared = src | ureact::lift_elements( square );
+    }
+
+    CHECK( squared.values() == std::vector{ 4, 1, 0, 1, 4 } );
+
+    src.set( 2, 3 );
+    CHECK( squared.values() == std::vector{ 4, 1, 9, 1, 4 } );
+}
+
+// Only elements which values have changed are marked dirty, both in sparse and dense updates
+TEST_CASE( "ureact::lift_elements (dirty elements)" )
+{
+    ureact::context ctx;
+
+    const size_t size = 64;
+    auto src = ureact::make_var_array<int>( ctx, size, 0 );
+
+    int calls = 0;
+    auto is_odd = src | ureact::lift_elements( [&]( const int i ) {
+        ++calls;
+        return i % 2 != 0;
+    } );
+
+    std::vector<size_t> changed;
+    ureact::observer obs = ureact::observe_elements(
+        is_odd, [&]( const size_t index, bool ) { changed.push_back( index ); } );
+
+    calls = 0;
+
+    SECTION( "sparse" )
+    {
+        {
+            ureact::transaction _{ ctx };
+            src.set( 1, 1 );
+            src.set( 2, 2 );
+        }
+
+        CHECK( calls == 2 );
+        CHECK( changed == std::vector<size_t>{ 1 } );
+        CHECK( is_odd.get( 1 ) );
+    }
+
+    SECTION( "dense" )
+    {
+        {
+            ureact::transaction _{ ctx };
+            for( size_t i = 0; i < size; ++i )
+                src.set( i, static_cast<int>( i * 2 ) );
+            src.set( 33, 33 );
+        }
+
+        CHECK( calls == static_cast<int>( size ) );
+        CHECK( changed == std::vector<size_t>{ 33 } );
+        CHECK( is_odd.get( 33 ) );
+        CHECK_FALSE( is_odd.get( 32 ) );
+    }
+}
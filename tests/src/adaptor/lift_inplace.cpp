@@ -0,0 +1,99 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/lift_inplace.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/count.hpp"
+#include "ureact/adaptor/monitor.hpp"
+#include "ureact/transaction.hpp"
+
+// Calculate value in-place reusing the previous value
+TEST_CASE( "ureact::lift_inplace" )
+{
+    ureact::context ctx;
+
+    auto size = ureact::make_var( ctx, 3 );
+    auto filler = ureact::make_var( ctx, 1 );
+
+    // size is clamped to 4, so bigger sizes don't change the result
+    const auto fill = []( std::vector<int>& out, int size, int filler ) {
+        const size_t new_size = size_t( std::min( size, 4 ) );
+        const bool same = out.size() == new_size
+                       && std::all_of( out.begin(), out.end(), [filler]( int value ) { //
+                              return value == filler;
+                          } );
+        if( same )
+            return false;
+        out.assign( new_size, filler );
+        return true;
+    };
+
+    ureact::signal<std::vector<int>> filled;
+
+    SECTION( "Functional syntax" )
+    {
+        filled = ureact::lift_inplace( with( size, filler ), std::vector<int>{}, fill );
+    }
+    SECTION( "Piped syntax" )
+    {
+        filled = with( size, filler ) | ureact::lift_inplace( std::vector<int>{}, fill );
+    }
+
+    const auto changes = ureact::count( ureact::monitor( filled ) );
+
+    CHECK( filled.get() == std::vector{ 1, 1, 1 } );
+
+    const int* data = filled.get().data();
+
+    filler <<= 2;
+    CHECK( filled.get() == std::vector{ 2, 2, 2 } );
+    CHECK( changes.get() == 1 );
+
+    // capacity is reused, so no reallocation happens
+    size <<= 2;
+    CHECK( filled.get() == std::vector{ 2, 2 } );
+    CHECK( filled.get().data() == data );
+    CHECK( changes.get() == 2 );
+
+    size <<= 4;
+    CHECK( filled.get() == std::vector{ 2, 2, 2, 2 } );
+    CHECK( changes.get() == 3 );
+
+    // size changes, but no change of the result is reported, so no propagation happens
+    size <<= 5;
+    CHECK( filled.get() == std::vector{ 2, 2, 2, 2 } );
+    CHECK( changes.get() == 3 );
+
+    {
+        ureact::transaction _{ ctx };
+        size <<= 6;
+        filler <<= 3;
+        filler <<= 2;
+    }
+    CHECK( changes.get() == 3 );
+}
+
+TEST_CASE( "ureact::lift_inplace (void)" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var( ctx, 1 );
+
+    auto doubled = ureact::lift_inplace( src, 0, []( int& out, int value ) { out = value * 2; } );
+    const auto changes = ureact::count( ureact::monitor( doubled ) );
+
+    CHECK( doubled.get() == 2 );
+
+    // without report, value is assumed changed
+    src.modify( []( int& ) {} );
+    CHECK( doubled.get() == 2 );
+    CHECK( changes.get() == 1 );
+}
@@ -0,0 +1,77 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/lift_memo.hpp"
+
+#include "catch2_extra.hpp"
+#include "ureact/signal.hpp"
+
+// Results of already seen arguments are taken from the cache
+TEST_CASE( "ureact::lift_memo" )
+{
+    ureact::context ctx;
+
+    auto spot = ureact::make_var( ctx, 100 );
+    auto rate = ureact::make_var( ctx, 2 );
+
+    int calls = 0;
+    const auto price = [&]( int spot, int rate ) {
+        ++calls;
+        return spot * ( 100 + rate );
+    };
+
+    ureact::signal<int> result;
+
+    SECTION( "Functional syntax" )
+    {
+        result = ureact::lift_memo( with( spot, rate ), price );
+    }
+    SECTION( "Piped syntax" )
+    {
+        result = with( spot, rate ) | ureact::lift_memo( price, 8 );
+    }
+    SECTION( "Custom hasher" )
+    {
+        const auto hasher = []( int spot, int rate ) { return size_t( spot * 31 + rate ); };
+        result = ureact::lift_memo( with( spot, rate ), price, 8, hasher );
+    }
+
+    CHECK( result.get() == 10200 );
+    CHECK( calls == 1 );
+
+    // oscillating inputs
+    for( int i : { 101, 100, 101, 100 } )
+        spot <<= i;
+
+    CHECK( result.get() == 10200 );
+    CHECK( calls == 2 );
+
+    rate <<= 3;
+    rate <<= 2;
+
+    CHECK( result.get() == 10200 );
+    CHECK( calls == 3 );
+}
+
+TEST_CASE( "ureact::lift_memo (single signal)" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var( ctx, 1 );
+
+    int calls = 0;
+    auto result = ureact::lift_memo_as<long>( src, [&]( int x ) {
+        ++calls;
+        return x * 2;
+    } );
+
+    for( int i : { 2, 1, 2 } )
+        src <<= i;
+
+    CHECK( result.get() == 4L );
+    CHECK( calls == 2 );
+}
@@ -0,0 +1,117 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/lift_multi.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/observe.hpp"
+#include "ureact/signal.hpp"
+
+// Evaluate function once and publish each element of its result as a separate signal
+TEST_CASE( "ureact::lift_multi" )
+{
+    ureact::context ctx;
+
+    auto book = ureact::make_var( ctx, std::vector<int>{ 10, 12, 11 } );
+
+    int calls = 0;
+    const auto scan = [&]( const std::vector<int>& prices ) {
+        ++calls;
+        const auto [min, max] = std::minmax_element( prices.begin(), prices.end() );
+        return std::make_tuple( *min, *max, std::to_string( *min + *max ) );
+    };
+
+    std::tuple<ureact::signal<int>, ureact::signal<int>, ureact::signal<std::string>> outputs;
+
+    SECTION( "Functional syntax" )
+    {
+        outputs = ureact::lift_multi( book, scan );
+    }
+    SECTION( "Piped syntax" )
+    {
+        outputs = book | ureact::lift_multi( scan );
+    }
+
+    const auto& [bid, ask, sum] = outputs;
+
+    int bid_changes = 0;
+    int ask_changes = 0;
+    ureact::observer bid_obs = ureact::observe( bid, [&]( int ) { ++bid_changes; } );
+    ureact::observer ask_obs = ureact::observe( ask, [&]( int ) { ++ask_changes; } );
+
+    CHECK( calls == 1 );
+    CHECK( bid.get() == 10 );
+    CHECK( ask.get() == 12 );
+    CHECK( sum.get() == "22" );
+
+    // only ask changes
+    book <<= std::vector<int>{ 10, 15 };
+
+    CHECK( calls == 2 );
+    CHECK( bid_changes == 0 );
+    CHECK( ask_changes == 1 );
+    CHECK( ask.get() == 15 );
+    CHECK( sum.get() == "25" );
+
+    // only bid changes
+    book <<= std::vector<int>{ 9, 15 };
+
+    CHECK( calls == 3 );
+    CHECK( bid_changes == 1 );
+    CHECK( ask_changes == 1 );
+    CHECK( bid.get() == 9 );
+    CHECK( sum.get() == "24" );
+}
+
+TEST_CASE( "ureact::lift_multi (several arguments)" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 7 );
+    auto b = ureact::make_var( ctx, 2 );
+
+    auto [quot, rem] = ureact::lift_multi( with( a, b ), []( int lhs, int rhs ) { //
+        return std::pair{ lhs / rhs, lhs % rhs };
+    } );
+
+    auto restored = quot * b + rem;
+
+    CHECK( quot.get() == 3 );
+    CHECK( rem.get() == 1 );
+
+    b <<= 3;
+    CHECK( quot.get() == 2 );
+    CHECK( rem.get() == 1 );
+    CHECK( restored.get() == 7 );
+
+    a <<= 11;
+    CHECK( restored.get() == 11 );
+}
+
+// Outputs of function of constants are constants
+TEST_CASE( "ureact::lift_multi (constant)" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_const( ctx, 5 );
+
+    auto [twice, square] = ureact::lift_multi( a, []( int v ) { //
+        return std::array{ v * 2, v * v };
+    } );
+
+    CHECK( twice.get() == 10 );
+    CHECK( square.get() == 25 );
+    CHECK( get_internals( twice ).get_node_ptr()->is_constant() );
+    CHECK( get_internals( square ).get_node_ptr()->is_constant() );
+}
@@ -0,0 +1,132 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/lift_shared.hpp"
+
+#include <functional>
+
+#include "catch2_extra.hpp"
+#include "ureact/signal.hpp"
+
+namespace
+{
+
+int calls = 0;
+
+int counted_plus( int lhs, int rhs )
+{
+    ++calls;
+    return lhs + rhs;
+}
+
+int counted_minus( int lhs, int rhs )
+{
+    ++calls;
+    return lhs - rhs;
+}
+
+} // namespace
+
+// Structurally identical expressions share a single node
+TEST_CASE( "ureact::lift_shared" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 1 );
+    auto b = ureact::make_var( ctx, 2 );
+
+    ureact::signal<int> sum1;
+    ureact::signal<int> sum2;
+
+    SECTION( "Functional syntax" )
+    {
+        sum1 = ureact::lift_shared( with( a, a ), std::plus<>{} );
+        sum2 = ureact::lift_shared( a, std::plus<>{}, a );
+    }
+    SECTION( "Piped syntax" )
+    {
+        sum1 = with( a, a ) | ureact::lift_shared( std::plus<>{} );
+        sum2 = with( a, a ) | ureact::lift_shared( std::plus<>{} );
+    }
+
+    CHECK( sum1.equal_to( sum2 ) );
+    CHECK( sum1.get() == 2 );
+
+    // different dependencies, order of dependencies or functions result in different nodes
+    auto sum3 = ureact::lift_shared( with( a, b ), std::plus<>{} );
+    auto sum4 = ureact::lift_shared( with( b, a ), std::plus<>{} );
+    auto mul = ureact::lift_shared( with( a, a ), std::multiplies<>{} );
+
+    CHECK_FALSE( sum1.equal_to( sum3 ) );
+    CHECK_FALSE( sum3.equal_to( sum4 ) );
+    CHECK_FALSE( sum1.equal_to( mul ) );
+
+    a <<= 3;
+
+    CHECK( sum1.get() == 6 );
+    CHECK( sum2.get() == 6 );
+    CHECK( sum3.get() == 5 );
+    CHECK( mul.get() == 9 );
+}
+
+// Function pointers are identified by their address
+TEST_CASE( "ureact::lift_shared (function pointer)" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 1 );
+    auto b = ureact::make_var( ctx, 10 );
+
+    calls = 0;
+
+    auto plus1 = ureact::lift_shared( with( a, b ), &counted_plus );
+    auto plus2 = ureact::lift_shared( with( a, b ), &counted_plus );
+    auto minus = ureact::lift_shared( with( a, b ), &counted_minus );
+
+    CHECK( plus1.equal_to( plus2 ) );
+    CHECK_FALSE( plus1.equal_to( minus ) );
+    CHECK( calls == 2 );
+
+    a <<= 2;
+
+    // the shared node is evaluated once per turn
+    CHECK( calls == 4 );
+    CHECK( plus2.get() == 12 );
+    CHECK( minus.get() == -8 );
+}
+
+// Shared node lives while any of its signals is alive
+TEST_CASE( "ureact::lift_shared (lifetime)" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 1 );
+
+    const auto square = []( int v ) { return v * v; };
+
+    auto s1 = ureact::lift_shared( a, square );
+    auto s2 = ureact::lift_shared( a, square );
+    CHECK( s1.equal_to( s2 ) );
+
+    s1 = ureact::signal<int>{};
+    auto s3 = ureact::lift_shared( a, square );
+    CHECK( s2.equal_to( s3 ) );
+
+    s2 = ureact::signal<int>{};
+    s3 = ureact::signal<int>{};
+
+    a <<= 5;
+
+    auto s4 = ureact::lift_shared( a, square );
+    CHECK( s4.get() == 25 );
+
+    // Different contexts never share nodes
+    ureact::context ctx2;
+    auto a2 = ureact::make_var( ctx2, 5 );
+    auto s5 = ureact::lift_shared( a2, square );
+    CHECK_FALSE( s4.equal_to( s5 ) );
+}
@@ -0,0 +1,131 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/observe_change.hpp"
+
+#include <utility>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "copy_stats.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/signal.hpp"
+#include "ureact/transaction.hpp"
+
+// Calls the function with old and new values on signal change
+TEST_CASE( "ureact::observe_change" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var<int>( ctx, -1 );
+    auto squared = src * src;
+
+    std::vector<std::pair<int, int>> src_changes;
+    std::vector<std::pair<int, int>> squared_changes;
+
+    const auto collect_to = []( std::vector<std::pair<int, int>>& out ) {
+        return [&out]( const int old_value, const int new_value ) {
+            out.emplace_back( old_value, new_value );
+        };
+    };
+
+    ureact::observer obs_src;
+    ureact::observer obs_squared;
+
+    SECTION( "Functional syntax" )
+    {
+        obs_src = ureact::observe_change( src, collect_to( src_changes ) );
+        obs_squared = ureact::observe_change( squared, collect_to( squared_changes ) );
+    }
+    SECTION( "Piped syntax" )
+    {
+        obs_src = src | ureact::observe_change( collect_to( src_changes ) );
+        obs_squared = squared | ureact::observe_change( collect_to( squared_changes ) );
+    }
+
+    for( int i : { 0, 0, 1, -1, 2 } )
+        src <<= i;
+
+    CHECK( src_changes
+           == std::vector<std::pair<int, int>>{ { -1, 0 }, { 0, 1 }, { 1, -1 }, { -1, 2 } } );
+    CHECK( squared_changes == std::vector<std::pair<int, int>>{ { 1, 0 }, { 0, 1 }, { 1, 4 } } );
+}
+
+// In place modifications report the value before the transaction
+TEST_CASE( "ureact::observe_change (modify)" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var<std::vector<int>>( ctx, {} );
+
+    std::vector<std::pair<size_t, size_t>> sizes;
+
+    ureact::observer obs = ureact::observe_change(
+        src, [&]( const std::vector<int>& old_value, const std::vector<int>& new_value ) {
+            sizes.emplace_back( old_value.size(), new_value.size() );
+        } );
+
+    src.modify( []( std::vector<int>& v ) { v.push_back( 1 ); } );
+
+    {
+        ureact::transaction _{ ctx };
+        src.modify( []( std::vector<int>& v ) { v.push_back( 2 ); } );
+        src.modify( []( std::vector<int>& v ) { v.push_back( 3 ); } );
+    }
+
+    src <<= std::vector<int>{};
+
+    CHECK( sizes == std::vector<std::pair<size_t, size_t>>{ { 0, 1 }, { 1, 3 }, { 3, 0 } } );
+}
+
+TEST_CASE( "ureact::observe_change (stop_and_detach)" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var<int>( ctx, 0 );
+
+    std::vector<int> old_values;
+
+    ureact::observer obs = ureact::observe_change( src, [&]( const int old_value, int ) {
+        old_values.push_back( old_value );
+        return old_value < 1 ? ureact::observer_action::next
+                             : ureact::observer_action::stop_and_detach;
+    } );
+
+    for( int i : { 1, 2, 3, 4 } )
+        src <<= i;
+
+    CHECK( old_values == std::vector<int>{ 0, 1 } );
+}
+
+// Previous value is kept by swapping buffers, not by copying
+TEST_CASE( "ureact::observe_change (copy stats)" )
+{
+    ureact::context ctx;
+
+    copy_stats stats;
+
+    auto src = ureact::make_var( ctx, copy_counter{ 1, &stats } );
+
+    int old_sum = 0;
+    int new_sum = 0;
+    ureact::observer obs = ureact::observe_change(
+        src, [&]( const copy_counter& old_value, const copy_counter& new_value ) {
+            old_sum += old_value.v;
+            new_sum += new_value.v;
+        } );
+
+    // previous value storage is initialized with a copy of the current value
+    CHECK( stats.copy_count == 1 );
+
+    src <<= copy_counter{ 2, &stats };
+    src <<= copy_counter{ 3, &stats };
+
+    CHECK( stats.copy_count == 1 );
+    CHECK( old_sum == 1 + 2 );
+    CHECK( new_sum == 2 + 3 );
+}
@@ -0,0 +1,72 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/observe_elements.hpp"
+
+#include <utility>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/signal_array.hpp"
+#include "ureact/transaction.hpp"
+
+TEST_CASE( "ureact::observe_elements" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var_array<int>( ctx, 8, 0 );
+
+    std::vector<std::pair<size_t, int>> changes;
+    const auto collect = [&]( const size_t index, const int value ) {
+        changes.emplace_back( index, value );
+    };
+
+    ureact::observer obs;
+
+    SECTION( "Functional syntax" )
+    {
+        obs = ureact::observe_elements( src, collect );
+    }
+    SECTION( "Piped syntax" )
+    {
+        obs = src | ureact::observe_elements( collect );
+    }
+
+    src.set( 3, 1 );
+    {
+        ureact::transaction _{ ctx };
+        src.set( 7, 2 );
+        src.set( 0, 3 );
+    }
+
+    CHECK( changes == std::vector<std::pair<size_t, int>>{ { 3, 1 }, { 7, 2 }, { 0, 3 } } );
+}
+
+TEST_CASE( "ureact::observe_elements (stop_and_detach)" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var_array<int>( ctx, 8, 0 );
+
+    std::vector<size_t> changed;
+    ureact::observer obs
+        = ureact::observe_elements( src, [&]( const size_t index, int ) -> ureact::observer_action {
+              changed.push_back( index );
+              return index == 5 ? ureact::observer_action::stop_and_detach
+                                : ureact::observer_action::next;
+          } );
+
+    {
+        ureact::transaction _{ ctx };
+        src.set( 1, 1 );
+        src.set( 5, 1 );
+        src.set( 6, 1 );
+    }
+    src.set( 2, 1 );
+
+    CHECK( changed == std::vector<size_t>{ 1, 5 } );
+}
@@ -0,0 +1,146 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/publish.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <tuple>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/transaction.hpp"
+
+TEST_CASE( "ureact::publish" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 1 );
+    auto b = ureact::make_var<std::string>( ctx, "b" );
+
+    ureact::snapshot_reader<int, std::string> reader;
+    CHECK_FALSE( reader.has_value() );
+    CHECK( reader.version() == 0 );
+
+    ureact::observer obs;
+
+    SECTION( "Functional syntax" )
+    {
+        obs = ureact::publish( with( a, b ), reader );
+    }
+    SECTION( "Piped syntax" )
+    {
+        obs = with( a, b ) | ureact::publish( reader );
+    }
+
+    // Current values are published immediately
+    CHECK( reader.has_value() );
+    CHECK( reader.get() == std::make_tuple( 1, std::string( "b" ) ) );
+    CHECK( reader.version() == 1 );
+
+    {
+        ureact::transaction _{ ctx };
+        a <<= 2;
+        b <<= "bb";
+    }
+    CHECK( reader.read( []( const int a_value, const std::string& b_value ) {
+        return std::to_string( a_value ) + b_value;
+    } ) == "2bb" );
+    CHECK( reader.version() == 2 );
+
+    // Nothing is published after the observer is detached
+    obs.detach();
+    a <<= 3;
+    CHECK( std::get<0>( reader.get() ) == 2 );
+}
+
+TEST_CASE( "ureact::publish (single signal)" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var( ctx, 1 );
+
+    ureact::snapshot_reader<int> reader;
+    ureact::observer obs = src | ureact::publish( reader );
+
+    src <<= 5;
+    CHECK( reader.get() == std::make_tuple( 5 ) );
+}
+
+// Slot held by a reader is not overwritten, a new slot is allocated if there are no free slots
+TEST_CASE( "ureact::publish (slots held by readers)" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var( ctx, 0 );
+
+    ureact::snapshot_reader<int> reader{ 2 };
+    ureact::observer obs = src | ureact::publish( reader );
+
+    reader.read( [&]( const int held_value ) {
+        // The other slot is free
+        src <<= 1;
+        CHECK( reader.get() == std::make_tuple( 1 ) );
+        CHECK( reader.get_buffer()->slot_count() == 2 );
+
+        // The only slot not held by this reader is the current one, so one more slot is used
+        src <<= 2;
+        CHECK( reader.get() == std::make_tuple( 2 ) );
+        CHECK( reader.get_buffer()->slot_count() == 3 );
+
+        // Held value is not modified
+        CHECK( held_value == 0 );
+    } );
+
+    // Released slots are reused
+    src <<= 3;
+    src <<= 4;
+    CHECK( reader.get() == std::make_tuple( 4 ) );
+    CHECK( reader.get_buffer()->slot_count() == 3 );
+}
+
+// Values of several signals are always read as of the same turn
+TEST_CASE( "ureact::publish (concurrent readers)" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 0 );
+    auto doubled = a * 2;
+
+    ureact::snapshot_reader<int, int> reader;
+    ureact::observer obs = with( a, doubled ) | ureact::publish( reader );
+
+    std::atomic<bool> done{ false };
+    std::atomic<int> inconsistent{ 0 };
+
+    const auto read_loop = [&, reader] {
+        while( !done.load() )
+        {
+            reader.read( [&]( const int a_value, const int doubled_value ) {
+                if( doubled_value != a_value * 2 )
+                    ++inconsistent;
+            } );
+        }
+    };
+
+    std::thread reader_1( read_loop );
+    std::thread reader_2( read_loop );
+
+    for( int i = 1; i <= 5000; ++i )
+        a <<= i;
+
+    done = true;
+    reader_1.join();
+    reader_2.join();
+
+    CHECK( inconsistent.load() == 0 );
+
+    // Each turn is published, and the number of slots is bounded by the number of readers
+    CHECK( reader.get() == std::make_tuple( 5000, 10000 ) );
+    CHECK( reader.get_buffer()->slot_count() <= 4 );
+}
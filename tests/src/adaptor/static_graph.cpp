@@ -0,0 +1,92 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/static_graph.hpp"
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/count.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/monitor.hpp"
+#include "ureact/transaction.hpp"
+
+// Evaluate graph with fan-out in a single node
+TEST_CASE( "ureact::static_graph" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 1 );
+    auto b = ureact::make_var( ctx, 2 );
+
+    int sum_calls = 0;
+    int abs_calls = 0;
+    int product_calls = 0;
+
+    // slot 0 - a, slot 1 - b
+    const auto [sum, abs, product] = ureact::static_graph( with( a, b ),
+        ureact::static_node<0, 1>( [&]( int a, int b ) { // slot 2
+            ++sum_calls;
+            return a + b;
+        } ),
+        ureact::static_node<0>( [&]( int a ) { // slot 3
+            ++abs_calls;
+            return a < 0 ? -a : a;
+        } ),
+        ureact::static_node<2, 3>( [&]( int sum, int abs ) { // slot 4
+            ++product_calls;
+            return sum * abs;
+        } ) );
+
+    static_assert( std::is_same_v<decltype( product ), const ureact::signal<int>> );
+
+    const auto sum_changes = ureact::count( ureact::monitor( sum ) );
+    const auto abs_changes = ureact::count( ureact::monitor( abs ) );
+    const auto product_changes = ureact::count( ureact::monitor( product ) );
+
+    CHECK( std::tie( sum.get(), abs.get(), product.get() ) == std::tuple{ 3, 1, 3 } );
+    CHECK( std::tie( sum_calls, abs_calls, product_calls ) == std::tuple{ 1, 1, 1 } );
+
+    // all nodes are re-evaluated
+    a <<= 2;
+    CHECK( std::tie( sum.get(), abs.get(), product.get() ) == std::tuple{ 4, 2, 8 } );
+    CHECK( std::tie( sum_calls, abs_calls, product_calls ) == std::tuple{ 2, 2, 2 } );
+
+    // sum and abs are unchanged, so product is not re-evaluated
+    {
+        ureact::transaction _{ ctx };
+        a <<= -2;
+        b <<= 6;
+    }
+    CHECK( std::tie( sum.get(), abs.get(), product.get() ) == std::tuple{ 4, 2, 8 } );
+    CHECK( std::tie( sum_calls, abs_calls, product_calls ) == std::tuple{ 3, 3, 2 } );
+
+    // only outputs of changed nodes are propagated
+    b <<= 3;
+    CHECK( std::tie( sum.get(), abs.get(), product.get() ) == std::tuple{ 1, 2, 2 } );
+    CHECK( sum_changes.get() == 2 );
+    CHECK( abs_changes.get() == 1 );
+    CHECK( product_changes.get() == 2 );
+}
+
+// Nodes can be declared once and passed by const reference
+TEST_CASE( "ureact::static_graph (const nodes)" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 1 );
+
+    const auto doubled = ureact::static_node<0>( []( int a ) { return a * 2; } );
+    const auto squared = ureact::static_node<1>( []( int a ) { return a * a; } );
+
+    const auto [doubled_out, squared_out] = ureact::static_graph( with( a ), doubled, squared );
+
+    CHECK( doubled_out.get() == 2 );
+    CHECK( squared_out.get() == 4 );
+
+    a <<= 3;
+    CHECK( doubled_out.get() == 6 );
+    CHECK( squared_out.get() == 36 );
+}
@@ -0,0 +1,157 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/adaptor/switch_on.hpp"
+
+#include <string>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/observe.hpp"
+#include "ureact/transaction.hpp"
+
+TEST_CASE( "ureact::switch_on" )
+{
+    ureact::context ctx;
+
+    auto index = ureact::make_var<size_t>( ctx, 0 );
+    auto a = ureact::make_var( ctx, 1 );
+    auto b = ureact::make_var( ctx, 10 );
+    auto c = ureact::make_var( ctx, 100 );
+    auto b_doubled = b * 2;
+
+    ureact::signal<int> selected = ureact::switch_on( index, a, b_doubled, c );
+
+    std::vector<int> history;
+    ureact::observer obs = ureact::observe( selected, [&]( int v ) { history.push_back( v ); } );
+
+    CHECK( selected.get() == 1 );
+
+    index.set( 1 );
+    CHECK( selected.get() == 20 );
+
+    index.set( 2 );
+    CHECK( selected.get() == 100 );
+
+    // Changes of candidates which are not selected are not propagated
+    a.set( 2 );
+    b.set( 11 );
+    CHECK( selected.get() == 100 );
+
+    c.set( 101 );
+    CHECK( selected.get() == 101 );
+
+    // Changes of the index and of the newly selected candidate are propagated once
+    {
+        ureact::transaction _{ ctx };
+        index.set( 0 );
+        a.set( 3 );
+    }
+    CHECK( selected.get() == 3 );
+
+    // Switching to a candidate with the same value is not propagated
+    c.set( 3 );
+    index.set( 2 );
+
+    CHECK( history == std::vector<int>{ 20, 100, 101, 3 } );
+}
+
+TEST_CASE( "ureact::switch_on (value without equality)" )
+{
+    ureact::context ctx;
+
+    // has no equality operator, so any new value of the switch is considered changed
+    struct box
+    {
+        int value;
+    };
+
+    auto index = ureact::make_var<size_t>( ctx, 0 );
+    auto a = ureact::make_var( ctx, box{ 1 } );
+    auto b = ureact::make_var( ctx, box{ 2 } );
+
+    auto selected = ureact::switch_on( index, a, b );
+
+    int changes = 0;
+    ureact::observer obs = ureact::observe( selected, [&]( const box& ) { ++changes; } );
+
+    // Changes of candidates which are not selected are not propagated
+    b.set( box{ 3 } );
+    CHECK( changes == 0 );
+
+    a.set( box{ 4 } );
+    CHECK( selected.get().value == 4 );
+    CHECK( changes == 1 );
+
+    index.set( 1 );
+    CHECK( selected.get().value == 3 );
+    CHECK( changes == 2 );
+
+    a.set( box{ 5 } );
+    CHECK( changes == 2 );
+}
+
+TEST_CASE( "ureact::switch_on (index out of range)" )
+{
+    ureact::context ctx;
+
+    auto index = ureact::make_var<int>( ctx, 5 );
+    auto a = ureact::make_var( ctx, 1 );
+    auto b = ureact::make_var( ctx, 2 );
+
+    // The first candidate is selected on creation
+    auto selected = ureact::switch_on( index, a, b );
+    CHECK( selected.get() == 1 );
+
+    index.set( 1 );
+    CHECK( selected.get() == 2 );
+
+    // The previously selected candidate stays selected
+    index.set( -1 );
+    CHECK( selected.get() == 2 );
+
+    b.set( 3 );
+    CHECK( selected.get() == 3 );
+
+    a.set( 4 );
+    CHECK( selected.get() == 3 );
+}
+
+TEST_CASE( "ureact::switch_on (enum index)" )
+{
+    ureact::context ctx;
+
+    enum class mode
+    {
+        off,
+        on
+    };
+
+    auto current_mode = ureact::make_var( ctx, mode::off );
+    auto off_text = ureact::make_const<std::string>( ctx, "off" );
+    auto on_text = ureact::make_var<std::string>( ctx, "on" );
+
+    auto text = ureact::switch_on( current_mode, off_text, on_text );
+    CHECK( text.get() == "off" );
+
+    current_mode.set( mode::on );
+    CHECK( text.get() == "on" );
+}
+
+TEST_CASE( "ureact::switch_on (constant)" )
+{
+    ureact::context ctx;
+
+    auto index = ureact::make_const<int>( ctx, 1 );
+    auto a = ureact::make_const( ctx, 1 );
+    auto b = ureact::make_const( ctx, 2 );
+
+    auto selected = ureact::switch_on( index, a, b );
+    CHECK( selected.get() == 2 );
+    CHECK( get_internals( selected ).get_node_ptr()->is_constant() );
+}
@@ -0,0 +1,57 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+
+#include "catch2_extra.hpp"
+#include "ureact/detail/has_changed.hpp"
+
+namespace
+{
+
+// Compare equal buffers, so the whole buffer is traversed
+template <typename T>
+void compare_buffers( ankerl::nanobench::Bench& bench, const size_t size )
+{
+    const std::vector<T> lhs( size, T( 1 ) );
+    const std::vector<T> rhs( size, T( 1 ) );
+
+    const std::string suffix = std::to_string( size );
+
+    bench.run( "operator== " + suffix, [&] {
+        bench.doNotOptimizeAway( !( lhs == rhs ) ); //
+    } );
+
+    bench.run( "has_changed " + suffix, [&] {
+        bench.doNotOptimizeAway( ureact::detail::has_changed( lhs, rhs ) ); //
+    } );
+}
+
+template <typename T>
+void compare_buffers_of( const char* title )
+{
+    ankerl::nanobench::Bench b;
+    b.title( title );
+    b.warmup( 10 );
+    b.performanceCounters( false );
+
+    for( size_t size : { 1'000, 32'000, 1'000'000 } )
+        compare_buffers<T>( b, size );
+}
+
+} // namespace
+
+TEST_CASE( "Benchmark has_changed" )
+{
+    compare_buffers_of<int>( "has_changed std::vector<int>" );
+    compare_buffers_of<float>( "has_changed std::vector<float>" );
+    compare_buffers_of<double>( "has_changed std::vector<double>" );
+}
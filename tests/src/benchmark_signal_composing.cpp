@@ -74,6 +74,27 @@ void signal_functions_separate( ankerl::nanobench::Bench& bench )
     perform_test( "separate", bench, a, d );
 }
 
+// Same as separate, but single consumer intermediate signals are fused by context::freeze()
+void signal_functions_separate_frozen( ankerl::nanobench::Bench& bench )
+{
+    ureact::context ctx;
+    auto a = make_var( ctx, 1 );
+
+    auto b1 = a + a;
+    auto b2 = a + a;
+    auto b3 = a + a;
+    auto b4 = a + a;
+
+    auto c1 = b1 * b2;
+    auto c2 = b3 * b4;
+
+    auto d = c1 + c2;
+
+    ctx.freeze();
+
+    perform_test( "separate frozen", bench, a, d );
+}
+
 } // namespace
 
 TEST_CASE( "Benchmark signal composing" )
@@ -87,4 +108,5 @@ TEST_CASE( "Benchmark signal composing" )
     signal_functions_baseline( b );
     signal_functions_expression( b );
     signal_functions_separate( b );
+    signal_functions_separate_frozen( b );
 }
@@ -260,4 +260,32 @@ TEST_CASE( "ureact::detail::slot_map" )
         CHECK( slot_map.capacity() > initialCapacity );
         CHECK( alive_indices.size() == slot_map.size() );
     }
+
+    SECTION( "Reserve" )
+    {
+        ureact::detail::slot_map<detector> slot_map;
+
+        const auto firstValueSlot = slot_map.emplace( &alive_indices, 1 );
+        const auto secondValueSlot = slot_map.emplace( &alive_indices, -1 );
+        const auto thirdValueSlot = slot_map.emplace( &alive_indices, 3 );
+        slot_map.erase( secondValueSlot ); // make a hole, so we can see if it is handled
+
+        slot_map.reserve( 100 );
+
+        CHECK( slot_map.capacity() >= 100 );
+        CHECK( slot_map.size() == 2 );
+        CHECK( alive_indices == std::set<int>{ 1, 3 } );
+
+        // slot indices stay valid
+        CHECK( slot_map[firstValueSlot].get_value() == 1 );
+        CHECK( slot_map[thirdValueSlot].get_value() == 3 );
+
+        // the hole is reused
+        CHECK( slot_map.emplace( &alive_indices, 2 ) == secondValueSlot );
+
+        // reserving less than capacity does nothing
+        const auto reservedCapacity = slot_map.capacity();
+        slot_map.reserve( 1 );
+        CHECK( slot_map.capacity() == reservedCapacity );
+    }
 }
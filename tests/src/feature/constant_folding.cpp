@@ -0,0 +1,78 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/collect.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/merge.hpp"
+#include "ureact/adaptor/observe.hpp"
+#include "ureact/adaptor/zip.hpp"
+#include "ureact/transaction.hpp"
+
+// Signals calculated only from constants are constants themselves
+TEST_CASE( "ConstantFolding" )
+{
+    ureact::context ctx;
+
+    auto x = ureact::make_var( ctx, 1 );
+    auto two = ureact::make_const( ctx, 2 );
+    auto three = ureact::make_const( ctx, 3 );
+
+    int calls = 0;
+    auto counted_plus = [&]( int lhs, int rhs ) {
+        ++calls;
+        return lhs + rhs;
+    };
+
+    ureact::signal<int> five = ureact::lift( with( two, three ), counted_plus );
+    ureact::signal<int> ten = ureact::lift( with( five, five ), counted_plus );
+    ureact::signal<int> x_plus_ten = ureact::lift( with( x, ten ), counted_plus );
+
+    int observed = 0;
+    ureact::observer obs = ureact::observe( ten, [&]( int ) { ++observed; } );
+
+    CHECK( five.get() == 5 );
+    CHECK( ten.get() == 10 );
+    CHECK( x_plus_ten.get() == 11 );
+    CHECK( calls == 3 );
+
+    // only node that depends on variable is recalculated
+    x <<= 2;
+    CHECK( x_plus_ten.get() == 12 );
+    CHECK( calls == 4 );
+    CHECK( observed == 0 );
+}
+
+TEST_CASE( "NeverFolding" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_source<int>( ctx );
+    auto never = ureact::make_never<int>( ctx );
+
+    SECTION( "merge ignores never" )
+    {
+        auto merged = ureact::collect<std::vector>( ureact::merge( src, never ) );
+        auto merged_never = ureact::collect<std::vector>( ureact::merge( never, never ) );
+
+        src << 1 << 2;
+
+        CHECK( merged.get() == std::vector{ 1, 2 } );
+        CHECK( merged_never.get().empty() );
+    }
+
+    SECTION( "zip with never never emits" )
+    {
+        int observed = 0;
+        ureact::observer obs
+            = ureact::observe( ureact::zip( src, never ), [&]( const auto& ) { ++observed; } );
+
+        src << 1 << 2;
+
+        CHECK( observed == 0 );
+    }
+}
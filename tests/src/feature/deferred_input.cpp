@@ -0,0 +1,160 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/collect.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/monitor.hpp"
+#include "ureact/adaptor/observe.hpp"
+#include "ureact/transaction.hpp"
+
+// Inputs can be deferred from callbacks to follow-up turns of the same propagation
+TEST_CASE( "DeferredInput" )
+{
+    ureact::context ctx;
+
+    SECTION( "Feedback loop" )
+    {
+        auto counter = ureact::make_var( ctx, 0 );
+        auto doubled = counter * 2;
+
+        std::vector<int> observed;
+        ureact::observer obs = ureact::observe( doubled, [&]( int value ) {
+            observed.push_back( value );
+            if( value < 6 )
+                counter.modify_deferred( []( int& v ) { ++v; } );
+        } );
+
+        counter <<= 1;
+
+        CHECK( counter.get() == 3 );
+        CHECK( observed == std::vector{ 2, 4, 6 } );
+    }
+
+    SECTION( "Deferred values are collapsed" )
+    {
+        auto trigger = ureact::make_source( ctx );
+        auto target = ureact::make_var( ctx, 0 );
+        auto target_values = ureact::collect<std::vector>( ureact::monitor( target ) );
+
+        ureact::observer obs = ureact::observe( trigger, [&]( ureact::unit ) {
+            target.set_deferred( 1 );
+            target.set_deferred( 2 );
+        } );
+
+        trigger();
+
+        CHECK( target_values.get() == std::vector{ 2 } );
+    }
+
+    SECTION( "Deferred events" )
+    {
+        auto src = ureact::make_source<int>( ctx );
+        auto echo = ureact::make_source<int>( ctx );
+        auto echo_values = ureact::collect<std::vector>( echo );
+
+        ureact::observer obs = ureact::observe( src, [&]( int value ) {
+            echo.emit_deferred( value );
+            echo.emit_deferred( value * 10 );
+        } );
+
+        {
+            ureact::transaction _{ ctx };
+            src << 1 << 2;
+            echo << -1;
+        }
+
+        CHECK( echo_values.get() == std::vector{ -1, 1, 10, 2, 20 } );
+    }
+
+    SECTION( "Outside of propagation" )
+    {
+        auto src = ureact::make_source<int>( ctx );
+        auto src_values = ureact::collect<std::vector>( src );
+
+        src.emit_deferred( 1 );
+        CHECK( src_values.get() == std::vector{ 1 } );
+
+        {
+            ureact::transaction _{ ctx };
+            src.emit_deferred( 2 );
+            src << 3;
+        }
+        CHECK( src_values.get() == std::vector{ 1, 3, 2 } );
+    }
+
+    SECTION( "Follow-up turns limit" )
+    {
+        ctx.set_max_deferred_turns( 2 );
+
+        auto counter = ureact::make_var( ctx, 0 );
+
+        ureact::observer obs = ureact::observe(
+            counter, [&]( int ) { counter.modify_deferred( []( int& v ) { ++v; } ); } );
+
+        counter <<= 1;
+        CHECK( counter.get() == 3 );
+
+        // pending deferred input is applied by the next propagation
+        auto unrelated = ureact::make_var( ctx, 0 );
+        unrelated <<= 1;
+        CHECK( counter.get() == 5 );
+    }
+
+    SECTION( "Modifier reporting change" )
+    {
+        // has no equality operator, so any applied value is considered changed
+        struct box
+        {
+            int value;
+        };
+
+        auto trigger = ureact::make_source<int>( ctx );
+        auto target = ureact::make_var( ctx, box{ 0 } );
+
+        int target_changes = 0;
+        ureact::observer target_obs
+            = ureact::observe( target, [&]( const box& ) { ++target_changes; } );
+
+        ureact::observer obs = ureact::observe( trigger, [&]( int value ) {
+            target.modify_deferred( [value]( box& b ) {
+                if( b.value == value )
+                    return false;
+                b.value = value;
+                return true;
+            } );
+        } );
+
+        trigger( 0 );
+        CHECK( target_changes == 0 );
+
+        trigger( 1 );
+        CHECK( target.get().value == 1 );
+        CHECK( target_changes == 1 );
+    }
+
+    SECTION( "Destroyed node with pending deferred input" )
+    {
+        ctx.set_max_deferred_turns( 1 );
+
+        {
+            auto counter = ureact::make_var( ctx, 0 );
+
+            ureact::observer obs = ureact::observe(
+                counter, [&]( int ) { counter.modify_deferred( []( int& v ) { ++v; } ); } );
+
+            // the second deferred increment stays queued
+            counter <<= 1;
+            CHECK( counter.get() == 2 );
+        }
+
+        // deferred input of the destroyed node is dropped
+        auto unrelated = ureact::make_var( ctx, 0 );
+        unrelated <<= 1;
+        CHECK( unrelated.get() == 1 );
+    }
+}
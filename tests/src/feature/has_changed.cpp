@@ -7,6 +7,8 @@
 //
 #include "ureact/detail/has_changed.hpp"
 
+#include <cmath>
+
 #include "catch2_extra.hpp"
 #include "ureact/adaptor/lift.hpp"
 #include "ureact/events.hpp"
@@ -118,4 +120,38 @@ TEST_CASE( "has_changed" )
     }
 }
 
+TEST_CASE( "has_changed for contiguous containers" )
+{
+    using ureact::detail::has_changed;
+
+    // comparison is performed in blocks, so check sizes that are not multiple of the block
+    std::vector<int> ints( 1000, 1 );
+    std::vector<float> floats( 1000, 1.0f );
+
+    CHECK_FALSE( has_changed( ints, ints ) );
+    CHECK_FALSE( has_changed( floats, floats ) );
+    CHECK( has_changed( ints, std::vector<int>( 999, 1 ) ) );
+    CHECK( has_changed( floats, std::vector<float>( 1001, 1.0f ) ) );
+
+    for( size_t i : { size_t( 0 ), size_t( 500 ), size_t( 999 ) } )
+    {
+        auto ints_copy = ints;
+        ints_copy[i] = 2;
+        auto floats_copy = floats;
+        floats_copy[i] = 2.0f;
+
+        CHECK( has_changed( ints, ints_copy ) );
+        CHECK( has_changed( floats, floats_copy ) );
+    }
+
+    // the same semantic as for floating point values themselves
+    CHECK_FALSE( has_changed( std::vector{ 0.0 }, std::vector{ -0.0 } ) );
+    CHECK( has_changed( std::vector{ std::nan( "" ) }, std::vector{ std::nan( "" ) } ) );
+
+    CHECK_FALSE( has_changed( std::array{ 1, 2, 3 }, std::array{ 1, 2, 3 } ) );
+    CHECK( has_changed( std::array{ 1, 2, 3 }, std::array{ 1, 2, 4 } ) );
+
+    CHECK_FALSE( has_changed( std::vector<int>{}, std::vector<int>{} ) );
+}
+
 // TODO: move here tests that demonstrates effect of has_changed on lift and fold
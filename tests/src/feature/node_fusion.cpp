@@ -0,0 +1,139 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/collect.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/monitor.hpp"
+#include "ureact/adaptor/observe.hpp"
+#include "ureact/transaction.hpp"
+
+// Chains of lvalue signals with a single consumer are updated on demand by the consumer
+TEST_CASE( "NodeFusion" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 1 );
+
+    int calls = 0;
+    auto counted_sum = [&]( int lhs, int rhs ) {
+        ++calls;
+        return lhs + rhs;
+    };
+    auto counted_mul = [&]( int lhs, int rhs ) {
+        ++calls;
+        return lhs * rhs;
+    };
+
+    auto b1 = ureact::lift( with( a, a ), counted_sum );
+    auto b2 = ureact::lift( with( a, a ), counted_sum );
+    auto b3 = ureact::lift( with( a, a ), counted_sum );
+    auto b4 = ureact::lift( with( a, a ), counted_sum );
+
+    auto c1 = ureact::lift( with( b1, b2 ), counted_mul );
+    auto c2 = ureact::lift( with( b3, b4 ), counted_mul );
+
+    ureact::signal<int> d = ureact::lift( with( c1, c2 ), counted_sum );
+
+    std::vector<int> observed;
+    ureact::observer obs = ureact::observe( d, [&]( int v ) { observed.push_back( v ); } );
+
+    ctx.freeze();
+
+    calls = 0;
+    a <<= 2;
+
+    // each node is still updated exactly once
+    CHECK( calls == 7 );
+    CHECK( d.get() == 32 );
+    CHECK( observed == std::vector<int>{ 32 } );
+
+    // fused signals are up to date after propagation
+    CHECK( b1.get() == 4 );
+    CHECK( c2.get() == 16 );
+
+    SECTION( "Unfuse on new consumer" )
+    {
+        // b1 gets the second successor
+        std::vector<int> b1_observed;
+        ureact::observer b1_obs
+            = ureact::observe( b1, [&]( int v ) { b1_observed.push_back( v ); } );
+
+        a <<= 3;
+
+        CHECK( b1_observed == std::vector<int>{ 6 } );
+        CHECK( d.get() == 72 );
+        CHECK( observed == std::vector<int>{ 32, 72 } );
+
+        // freeze is repeatable and leaves b1 unfused, because it has two successors
+        ctx.freeze();
+
+        a <<= 1;
+
+        CHECK( b1_observed == std::vector<int>{ 6, 2 } );
+        CHECK( d.get() == 8 );
+        CHECK( observed == std::vector<int>{ 32, 72, 8 } );
+    }
+
+    SECTION( "Unfuse on destruction of consumer" )
+    {
+        obs = ureact::observer{};
+        d = ureact::signal<int>{};
+
+        // c1 and c2 have lost their only successor
+        a <<= 3;
+
+        CHECK( c1.get() == 36 );
+        CHECK( c2.get() == 36 );
+    }
+}
+
+// Consumer of fused nodes is not updated if none of them has changed
+TEST_CASE( "NodeFusion (unchanged fused predecessor)" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 1 );
+    auto tens = a / 10;
+    auto tens_changes = ureact::collect<std::vector>( ureact::monitor( tens ) );
+
+    ctx.freeze();
+
+    for( int i : { 2, 5, 12, 15, 21, 3 } )
+        a <<= i;
+
+    CHECK( tens_changes.get() == std::vector<int>{ 1, 2, 0 } );
+}
+
+// Fused node is updated once even if it is reached by several paths within a transaction
+TEST_CASE( "NodeFusion (transaction)" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 1 );
+    auto b = ureact::make_var( ctx, 10 );
+
+    int calls = 0;
+    auto sum = ureact::lift( with( a, b ), [&]( int lhs, int rhs ) {
+        ++calls;
+        return lhs + rhs;
+    } );
+    auto result = sum * 2;
+
+    ctx.freeze();
+
+    calls = 0;
+
+    {
+        ureact::transaction _{ ctx };
+        a <<= 2;
+        b <<= 20;
+    }
+
+    CHECK( calls == 1 );
+    CHECK( result.get() == 44 );
+}
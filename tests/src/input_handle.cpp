@@ -0,0 +1,164 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/utility/input_handle.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/observe.hpp"
+#include "ureact/transaction.hpp"
+
+TEST_CASE( "ureact::input_handle" )
+{
+    ureact::context ctx;
+
+    auto src = ureact::make_var( ctx, 1 );
+    auto squared = src * src;
+
+    int changes = 0;
+    ureact::observer obs = ureact::observe( squared, [&]( int ) { ++changes; } );
+
+    ureact::input_handle<int> handle;
+    CHECK_FALSE( handle.is_valid() );
+
+    handle = ureact::input_handle<int>{ src };
+    CHECK( handle.is_valid() );
+    CHECK( handle.get_var().equal_to( src ) );
+
+    handle.set( 3 );
+    CHECK( src.get() == 3 );
+    CHECK( squared.get() == 9 );
+    CHECK( changes == 1 );
+
+    // Same value is not propagated
+    handle.set( 3 );
+    CHECK( changes == 1 );
+
+    // Works within transactions just like var_signal::set()
+    {
+        ureact::transaction _{ ctx };
+        handle.set( 4 );
+        handle.set( 5 );
+    }
+    CHECK( squared.get() == 25 );
+    CHECK( changes == 2 );
+}
+
+TEST_CASE( "ureact::set_many" )
+{
+    ureact::context ctx;
+
+    std::vector<ureact::var_signal<int>> vars;
+    std::vector<ureact::input_handle<int>> handles;
+    for( int i = 0; i < 100; ++i )
+    {
+        vars.push_back( ureact::make_var( ctx, 0 ) );
+        handles.emplace_back( vars.back() );
+    }
+
+    auto sum = ureact::lift( vars[0] + vars[1] + vars[50] + vars[99], []( int v ) { return v; } );
+
+    int changes = 0;
+    ureact::observer obs = ureact::observe( sum, [&]( int ) { ++changes; } );
+
+    std::vector<int> values( 100 );
+    for( int i = 0; i < 100; ++i )
+        values[i] = i;
+
+    SECTION( "lvalue values" )
+    {
+        ureact::set_many( handles, values );
+    }
+    SECTION( "rvalue values" )
+    {
+        ureact::set_many( handles, std::move( values ) );
+    }
+
+    CHECK( vars[42].get() == 42 );
+    CHECK( sum.get() == 0 + 1 + 50 + 99 );
+
+    // All values are propagated in a single turn
+    CHECK( changes == 1 );
+}
+
+TEST_CASE( "ureact::set_many (within transaction)" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var<std::string>( ctx, "a" );
+    auto b = ureact::make_var<std::string>( ctx, "b" );
+    auto ab = a + b;
+
+    int changes = 0;
+    ureact::observer obs = ureact::observe( ab, [&]( const std::string& ) { ++changes; } );
+
+    const std::vector handles{ ureact::input_handle<std::string>{ a },
+        ureact::input_handle<std::string>{ b } };
+
+    {
+        ureact::transaction _{ ctx };
+        ureact::set_many( handles, std::vector<std::string>{ "x", "y" } );
+        a.set( "z" );
+    }
+
+    CHECK( ab.get() == "zy" );
+    CHECK( changes == 1 );
+}
+
+TEST_CASE( "ureact::set_many (throwing assignment)" )
+{
+    ureact::context ctx;
+
+    struct picky
+    {
+        int value = 0;
+
+        picky() = default;
+
+        explicit picky( int value )
+            : value( value )
+        {}
+
+        picky( const picky& other )
+            : value( checked( other.value ) )
+        {}
+
+        picky& operator=( const picky& other )
+        {
+            value = checked( other.value );
+            return *this;
+        }
+
+        static int checked( const int value )
+        {
+            if( value < 0 )
+                throw std::invalid_argument( "negative value" );
+            return value;
+        }
+    };
+
+    auto a = ureact::make_var( ctx, picky{ 1 } );
+    auto b = ureact::make_var( ctx, picky{ 2 } );
+
+    const std::vector handles{ ureact::input_handle<picky>{ a }, ureact::input_handle<picky>{ b } };
+
+    std::vector<picky> values( 2 );
+    values[0].value = 3;
+    values[1].value = -1;
+    CHECK_THROWS_AS( ureact::set_many( handles, values ), std::invalid_argument );
+
+    // The transaction is finished, so values set before the exception are propagated
+    CHECK( a.get().value == 3 );
+    CHECK( b.get().value == 2 );
+
+    b.set( picky{ 4 } );
+    CHECK( b.get().value == 4 );
+}
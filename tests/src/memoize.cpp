@@ -0,0 +1,89 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/utility/memoize.hpp"
+
+#include <string>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/signal.hpp"
+
+TEST_CASE( "ureact::memoize" )
+{
+    int calls = 0;
+    auto concat = ureact::memoize<std::string, int>(
+        [&]( const std::string& s, int n ) {
+            ++calls;
+            std::string result;
+            for( int i = 0; i < n; ++i )
+                result += s;
+            return result;
+        },
+        4 );
+
+    CHECK( concat.capacity() == 4 );
+
+    CHECK( concat( "ab", 2 ) == "abab" );
+    CHECK( concat( "ab", 2 ) == "abab" );
+    CHECK( concat( "c", 3 ) == "ccc" );
+    CHECK( concat( "ab", 2 ) == "abab" );
+
+    CHECK( calls == 2 );
+    CHECK( concat.hits() == 2 );
+    CHECK( concat.misses() == 2 );
+
+    // copies share the cache
+    auto copy = concat;
+    CHECK( copy( "c", 3 ) == "ccc" );
+    CHECK( concat.hits() == 3 );
+
+    concat.clear();
+    CHECK( concat( "c", 3 ) == "ccc" );
+    CHECK( calls == 3 );
+    CHECK( concat.misses() == 3 );
+}
+
+// Direct-mapped cache keeps only the latest value of colliding keys
+TEST_CASE( "ureact::memoize (custom hasher)" )
+{
+    int calls = 0;
+    auto square = ureact::memoize<int>(
+        [&]( int x ) {
+            ++calls;
+            return x * x;
+        },
+        8,
+        []( int ) -> size_t { return 0; } );
+
+    CHECK( square( 2 ) == 4 );
+    CHECK( square( 3 ) == 9 );
+    CHECK( square( 3 ) == 9 );
+    CHECK( square( 2 ) == 4 );
+
+    CHECK( calls == 3 );
+    CHECK( square.hits() == 1 );
+    CHECK( square.misses() == 3 );
+}
+
+// Memoized function can be lifted, counters are available through the original object
+TEST_CASE( "ureact::memoize (lift)" )
+{
+    ureact::context ctx;
+
+    auto a = ureact::make_var( ctx, 1 );
+
+    auto expensive = ureact::memoize<int>( []( int x ) { return x * 100; } );
+    auto b = ureact::lift( a, expensive );
+
+    for( int i : { 2, 1, 2, 1, 3 } )
+        a <<= i;
+
+    CHECK( b.get() == 300 );
+    CHECK( expensive.misses() == 3 );
+    CHECK( expensive.hits() == 3 );
+}
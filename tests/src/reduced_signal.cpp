@@ -0,0 +1,154 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/reduced_signal.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/observe.hpp"
+#include "ureact/transaction.hpp"
+
+TEST_CASE( "ureact::reduce_signals" )
+{
+    ureact::context ctx;
+
+    ureact::reduced_signal<int> sum = ureact::reduce_signals( ctx, std::plus<>{}, 0 );
+
+    // The reduction of the empty set is identity
+    CHECK( sum.get() == 0 );
+    CHECK( sum.member_count() == 0 );
+
+    std::vector<ureact::var_signal<int>> vars;
+    std::vector<ureact::reduced_signal<int>::member_id> ids;
+    for( int i = 1; i <= 10; ++i )
+    {
+        vars.push_back( ureact::make_var( ctx, i ) );
+        ids.push_back( sum.add( vars.back() ) );
+        CHECK( sum.get() == i * ( i + 1 ) / 2 );
+    }
+    CHECK( sum.member_count() == 10 );
+
+    vars[3].set( 40 );
+    CHECK( sum.get() == 55 - 4 + 40 );
+
+    sum.remove( ids[3] );
+    CHECK( sum.get() == 55 - 4 );
+    CHECK( sum.member_count() == 9 );
+
+    // Removed member doesn't affect the reduction anymore
+    vars[3].set( 400 );
+    CHECK( sum.get() == 55 - 4 );
+
+    // Slot of the removed member is reused
+    ids[3] = sum.add( vars[3] );
+    CHECK( sum.get() == 55 - 4 + 400 );
+    CHECK( sum.member_count() == 10 );
+
+    // Derived signals
+    auto doubled = sum * 2;
+    vars[0].set( 0 );
+    CHECK( doubled.get() == ( 55 - 4 + 400 - 1 ) * 2 );
+}
+
+TEST_CASE( "ureact::reduce_signals (min)" )
+{
+    ureact::context ctx;
+
+    const auto min = []( const int lhs, const int rhs ) { return std::min( lhs, rhs ); };
+    auto minimum = ureact::reduce_signals( ctx, min, INT_MAX );
+
+    auto a = ureact::make_var( ctx, 5 );
+    auto b = ureact::make_var( ctx, 3 );
+    auto c = ureact::make_const( ctx, 4 );
+    auto a_squared = a * a;
+
+    std::vector<int> history;
+    ureact::observer obs = ureact::observe( minimum, [&]( int v ) { history.push_back( v ); } );
+
+    {
+        ureact::transaction _{ ctx };
+        (void)minimum.add( a_squared );
+        (void)minimum.add( b );
+        (void)minimum.add( c );
+    }
+    CHECK( minimum.get() == 3 );
+
+    b.set( 10 );
+    CHECK( minimum.get() == 4 );
+
+    a.set( 1 );
+    CHECK( minimum.get() == 1 );
+
+    // Unchanged reduction is not propagated
+    b.set( 20 );
+
+    CHECK( history == std::vector<int>{ 3, 4, 1 } );
+}
+
+// A change of a single member recalculates only the path from its leaf to the root
+TEST_CASE( "ureact::reduce_signals (incremental)" )
+{
+    ureact::context ctx;
+
+    int calls = 0;
+    auto sum = ureact::reduce_signals(
+        ctx,
+        [&]( const int lhs, const int rhs ) {
+            ++calls;
+            return lhs + rhs;
+        },
+        0 );
+
+    std::vector<ureact::var_signal<int>> vars;
+    {
+        ureact::transaction _{ ctx };
+        for( int i = 0; i < 1024; ++i )
+        {
+            vars.push_back( ureact::make_var( ctx, 1 ) );
+            (void)sum.add( vars.back() );
+        }
+    }
+    CHECK( sum.get() == 1024 );
+
+    calls = 0;
+    vars[517].set( 2 );
+    CHECK( sum.get() == 1025 );
+    CHECK( calls == 10 );
+}
+
+// A member deeper than consumers of the reduction raises levels of the consumers
+TEST_CASE( "ureact::reduce_signals (deep member)" )
+{
+    ureact::context ctx;
+
+    auto x = ureact::make_var( ctx, 1 );
+    auto sum = ureact::reduce_signals( ctx, std::plus<>{}, 0 );
+
+    const auto combined = ureact::lift( with( sum, x ), []( int s, int v ) { //
+        return s * 100 + v;
+    } );
+
+    std::vector<int> observed;
+    ureact::observer obs
+        = ureact::observe( combined, [&]( const int value ) { observed.push_back( value ); } );
+
+    // the new member is deeper than combined
+    (void)sum.add( x + 0 + 0 + 0 );
+    CHECK( sum.get() == 1 );
+    CHECK( observed == std::vector{ 101 } );
+
+    // combined is evaluated once, after the reduction is updated
+    observed.clear();
+    x <<= 2;
+    CHECK( sum.get() == 2 );
+    CHECK( observed == std::vector{ 202 } );
+}
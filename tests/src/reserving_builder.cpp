@@ -0,0 +1,94 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/utility/reserving_builder.hpp"
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/transaction.hpp"
+
+TEST_CASE( "ureact::reserving_builder" )
+{
+    ureact::context ctx;
+
+    auto builder = ureact::make_reserving_builder<int, int>( //
+        []( const ureact::signal<int>& a, const ureact::signal<int>& b ) {
+            ureact::signal<int> sum = a + b;
+            ureact::signal<int> product = a * b;
+            return std::make_pair( sum, product );
+        } );
+
+    CHECK( builder.nodes_per_instance() == 0 );
+
+    SECTION( "Single instance" )
+    {
+        auto a = ureact::make_var( ctx, 2 );
+        auto b = ureact::make_var( ctx, 3 );
+
+        const auto [sum, product] = builder.instantiate( a, b );
+
+        CHECK( builder.nodes_per_instance() == 2 );
+        CHECK( sum.get() == 5 );
+        CHECK( product.get() == 6 );
+
+        a <<= 4;
+
+        CHECK( sum.get() == 7 );
+        CHECK( product.get() == 12 );
+    }
+
+    SECTION( "Bulk instantiation" )
+    {
+        const size_t count = 100;
+
+        std::vector<ureact::var_signal<int>> inputs;
+        inputs.reserve( count );
+        for( size_t i = 0; i < count; ++i )
+            inputs.push_back( ureact::make_var( ctx, static_cast<int>( i ) ) );
+
+        const auto factor = ureact::make_var( ctx, 1 );
+
+        const ureact::detail::react_graph& graph = get_internals( ctx ).get_graph();
+        const size_t node_count_before = graph.node_count();
+
+        // Node capacity observed before creation of each instance except the first one
+        std::vector<size_t> capacities;
+
+        const auto instances = builder.instantiate_n( count, [&]( size_t i ) { //
+            if( i > 0 )
+                capacities.push_back( graph.node_capacity() );
+            return std::make_tuple(
+                ureact::signal<int>{ inputs[i] }, ureact::signal<int>{ factor } );
+        } );
+
+        REQUIRE( instances.size() == count );
+        CHECK( builder.nodes_per_instance() == 2 );
+
+        // Node slots for all instances are reserved right after the first one is created,
+        // so the storage doesn't grow while the rest are created
+        CHECK( graph.node_count() == node_count_before + count * 2 );
+        REQUIRE( capacities.size() == count - 1 );
+        CHECK( capacities.front() >= node_count_before + count * 2 );
+        CHECK( graph.node_capacity() == capacities.front() );
+        for( const size_t capacity : capacities )
+            CHECK( capacity == capacities.front() );
+
+        {
+            ureact::transaction _{ ctx };
+            for( auto& input : inputs )
+                input <<= input.get() * 2;
+            factor <<= 3;
+        }
+
+        for( size_t i = 0; i < count; ++i )
+        {
+            const int value = static_cast<int>( i ) * 2;
+            CHECK( instances[i].first.get() == value + 3 );
+            CHECK( instances[i].second.get() == value * 3 );
+        }
+    }
+}
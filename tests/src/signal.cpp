@@ -7,9 +7,12 @@
 //
 #include "ureact/signal.hpp"
 
+#include <algorithm>
+
 #include "catch2_extra.hpp"
 #include "identity.hpp"
 #include "ureact/adaptor/lift.hpp"
+#include "ureact/transaction.hpp"
 
 // copyable and nothrow movable
 static_assert( std::is_default_constructible_v<ureact::signal<int>> );
@@ -293,5 +296,47 @@ TEST_CASE( "ureact::var_signal<S> (modify)" )
     CHECK( src.get() == 5 );
 }
 
+TEST_CASE( "ureact::var_signal<S> (modify with change report)" )
+{
+    ureact::context ctx;
+
+    ureact::var_signal src = ureact::make_var( ctx, std::vector{ 1, 2, 3 } );
+
+    int calls = 0;
+    ureact::signal size = ureact::lift( src, [&]( const std::vector<int>& v ) {
+        ++calls;
+        return v.size();
+    } );
+
+    // erase value if it is present, report if something is erased
+    auto erase = []( int value ) {
+        return [value]( std::vector<int>& v ) {
+            const auto it = std::find( v.begin(), v.end(), value );
+            if( it == v.end() )
+                return false;
+            v.erase( it );
+            return true;
+        };
+    };
+
+    CHECK( calls == 1 );
+
+    src.modify( erase( 4 ) );
+    CHECK( calls == 1 );
+
+    src <<= erase( 2 );
+    CHECK( size.get() == 2 );
+    CHECK( calls == 2 );
+
+    // changes are combined within a transaction
+    {
+        ureact::transaction _{ ctx };
+        src.modify( erase( 3 ) );
+        src.modify( erase( 4 ) );
+    }
+    CHECK( size.get() == 1 );
+    CHECK( calls == 3 );
+}
+
 // TODO: test all possible combinations of set and modify
 //       and check if result value is correct and has_changed optimization is correct
@@ -0,0 +1,104 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/signal_array.hpp"
+
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/observe_elements.hpp"
+#include "ureact/transaction.hpp"
+
+TEST_CASE( "ureact::signal_array (construction)" )
+{
+    ureact::context ctx;
+
+    SECTION( "default constructed" )
+    {
+        ureact::signal_array<int> arr;
+        CHECK_FALSE( arr.is_valid() );
+    }
+
+    SECTION( "from values" )
+    {
+        ureact::var_signal_array<int> arr = ureact::make_var_array( ctx, std::vector{ 1, 2, 3 } );
+        CHECK( arr.is_valid() );
+        CHECK( arr.size() == 3 );
+        CHECK( arr.values() == std::vector{ 1, 2, 3 } );
+    }
+
+    SECTION( "count copies of value" )
+    {
+        ureact::var_signal_array<int> arr = ureact::make_var_array( ctx, 4, 7 );
+        CHECK( arr.size() == 4 );
+        CHECK( arr.values() == std::vector{ 7, 7, 7, 7 } );
+    }
+}
+
+// Elements are changed independently, but the array is propagated as a single node
+TEST_CASE( "ureact::var_signal_array (set)" )
+{
+    ureact::context ctx;
+
+    auto arr = ureact::make_var_array<int>( ctx, 200, 0 );
+
+    std::vector<size_t> changed;
+    ureact::observer obs = ureact::observe_elements(
+        arr, [&]( const size_t index, int ) { changed.push_back( index ); } );
+
+    SECTION( "single element" )
+    {
+        arr.set( 5, 42 );
+        CHECK( arr.get( 5 ) == 42 );
+        CHECK( changed == std::vector<size_t>{ 5 } );
+    }
+
+    SECTION( "same value is ignored" )
+    {
+        arr.set( 5, 0 );
+        CHECK( changed.empty() );
+    }
+
+    SECTION( "transaction" )
+    {
+        {
+            ureact::transaction _{ ctx };
+            arr.set( 150, 1 );
+            arr.set( 3, 2 );
+            arr.set( 150, 3 );
+            arr.set( 64, 0 );
+        }
+
+        CHECK( arr.get( 150 ) == 3 );
+        CHECK( arr.get( 3 ) == 2 );
+
+        // Each changed element is reported once, elements set to the same value are not reported
+        CHECK( changed == std::vector<size_t>{ 150, 3 } );
+
+        changed.clear();
+        arr.set( 150, 4 );
+        CHECK( changed == std::vector<size_t>{ 150 } );
+    }
+
+    SECTION( "set and revert in transaction" )
+    {
+        {
+            ureact::transaction _{ ctx };
+            arr.set( 0, 5 );
+            arr.set( 70, 1 );
+            arr.set( 0, 0 );
+        }
+
+        // Only the last value of an element is compared with its current value
+        CHECK( arr.get( 0 ) == 0 );
+        CHECK( changed == std::vector<size_t>{ 70 } );
+
+        changed.clear();
+        arr.set( 0, 6 );
+        CHECK( changed == std::vector<size_t>{ 0 } );
+    }
+}
@@ -0,0 +1,119 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/struct_signal.hpp"
+
+#include <string>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/observe.hpp"
+#include "ureact/transaction.hpp"
+
+namespace
+{
+
+struct quote
+{
+    std::string symbol;
+    double bid = 0.0;
+    double ask = 0.0;
+
+    friend bool has_changed( const quote& lhs, const quote& rhs )
+    {
+        return lhs.symbol != rhs.symbol || lhs.bid != rhs.bid || lhs.ask != rhs.ask;
+    }
+};
+
+} // namespace
+
+TEST_CASE( "ureact::struct_signal" )
+{
+    ureact::context ctx;
+
+    ureact::var_struct_signal<quote> q = ureact::make_var_struct( ctx, quote{ "ABC", 1.0, 2.0 } );
+
+    ureact::signal<double> bid = q.field<&quote::bid>();
+    ureact::signal<double> ask = q.field<&quote::ask>();
+
+    int bid_changes = 0;
+    int ask_changes = 0;
+    int quote_changes = 0;
+    ureact::observer obs_bid = ureact::observe( bid, [&]( double ) { ++bid_changes; } );
+    ureact::observer obs_ask = ureact::observe( ask, [&]( double ) { ++ask_changes; } );
+    ureact::observer obs_quote = ureact::observe( q, [&]( const quote& ) { ++quote_changes; } );
+
+    CHECK( bid.get() == 1.0 );
+    CHECK( ask.get() == 2.0 );
+
+    SECTION( "set_field" )
+    {
+        q.set_field<&quote::bid>( 1.5 );
+        CHECK( bid.get() == 1.5 );
+        CHECK( q.get().bid == 1.5 );
+        CHECK( bid_changes == 1 );
+        CHECK( ask_changes == 0 );
+        CHECK( quote_changes == 1 );
+
+        // Setting the same value has no effect
+        q.set_field<&quote::bid>( 1.5 );
+        CHECK( bid_changes == 1 );
+        CHECK( quote_changes == 1 );
+    }
+
+    SECTION( "set_field in transaction" )
+    {
+        {
+            ureact::transaction _{ ctx };
+            q.set_field<&quote::bid>( 1.1 );
+            q.set_field<&quote::ask>( 2.2 );
+            q.set_field<&quote::bid>( 1.2 );
+        }
+        CHECK( bid.get() == 1.2 );
+        CHECK( ask.get() == 2.2 );
+        CHECK( bid_changes == 1 );
+        CHECK( ask_changes == 1 );
+        CHECK( quote_changes == 1 );
+    }
+
+    SECTION( "set" )
+    {
+        // All fields are considered changed, projections filter unchanged values themselves
+        q.set( quote{ "ABC", 1.0, 3.0 } );
+        CHECK( ask.get() == 3.0 );
+        CHECK( bid_changes == 0 );
+        CHECK( ask_changes == 1 );
+        CHECK( quote_changes == 1 );
+
+        q.set( quote{ "ABC", 1.0, 3.0 } );
+        CHECK( quote_changes == 1 );
+    }
+}
+
+// Projection is not evaluated if its field is not marked as changed
+TEST_CASE( "ureact::struct_signal (projection skips other fields)" )
+{
+    ureact::context ctx;
+
+    auto q = ureact::make_var_struct( ctx, quote{ "ABC", 1.0, 2.0 } );
+
+    int spread_calls = 0;
+    auto spread = ureact::lift( q.field<&quote::ask>(), [&]( double ask ) {
+        ++spread_calls;
+        return ask - 1.0;
+    } );
+    spread_calls = 0;
+
+    q.set_field<&quote::symbol>( "XYZ" );
+    q.set_field<&quote::bid>( 0.5 );
+    CHECK( spread_calls == 0 );
+
+    q.set_field<&quote::ask>( 4.0 );
+    CHECK( spread_calls == 1 );
+    CHECK( spread.get() == 3.0 );
+}
@@ -0,0 +1,129 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/transaction_group.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/count.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/adaptor/monitor.hpp"
+#include "ureact/adaptor/observe.hpp"
+
+TEST_CASE( "ureact::transaction_group" )
+{
+    ureact::context ctx_a;
+    ureact::context ctx_b;
+
+    auto a = ureact::make_var( ctx_a, 1 );
+    auto b = ureact::make_var( ctx_b, 10 );
+    auto a_changes = ureact::count( ureact::monitor( a ) );
+    auto b_changes = ureact::count( ureact::monitor( b ) );
+
+    SECTION( "finish on scope exit" )
+    {
+        {
+            ureact::transaction_group _{ ctx_a, ctx_b };
+            a <<= 2;
+            a <<= 3;
+            b <<= 20;
+            b <<= 30;
+
+            // Nothing is propagated until the whole group is finished
+            CHECK( a.get() == 1 );
+            CHECK( b.get() == 10 );
+        }
+
+        CHECK( a.get() == 3 );
+        CHECK( b.get() == 30 );
+        CHECK( a_changes.get() == 1 );
+        CHECK( b_changes.get() == 1 );
+    }
+
+    SECTION( "finish_parallel" )
+    {
+        ureact::transaction_group group{ ctx_a, ctx_b };
+        a <<= 2;
+        b <<= 20;
+        group.finish_parallel();
+
+        CHECK( a.get() == 2 );
+        CHECK( b.get() == 20 );
+        CHECK( a_changes.get() == 1 );
+        CHECK( b_changes.get() == 1 );
+    }
+
+    SECTION( "duplicate contexts" )
+    {
+        {
+            ureact::transaction_group _{ ctx_a, ctx_a, ctx_b };
+            a <<= 2;
+        }
+
+        CHECK( a.get() == 2 );
+        CHECK( a_changes.get() == 1 );
+    }
+}
+
+// Inputs passed from callbacks of one context into a following one are part of the same commit
+TEST_CASE( "ureact::transaction_group (cross-context input)" )
+{
+    ureact::context ctx_a;
+    ureact::context ctx_b;
+
+    auto price = ureact::make_var( ctx_a, 1 );
+    auto mirrored_price = ureact::make_var( ctx_b, 1 );
+    auto quantity = ureact::make_var( ctx_b, 1 );
+    auto total = mirrored_price * quantity;
+
+    std::vector<int> totals;
+    ureact::observer obs_total
+        = ureact::observe( total, [&]( int value ) { totals.push_back( value ); } );
+    ureact::observer obs_price
+        = ureact::observe( price, [&]( int value ) { mirrored_price <<= value; } );
+
+    {
+        ureact::transaction_group _{ ctx_a, ctx_b };
+        price <<= 5;
+        quantity <<= 3;
+    }
+
+    // No intermediate total with only one of inputs changed
+    CHECK( totals == std::vector<int>{ 15 } );
+}
+
+// A throwing callback of one context doesn't leave following contexts in a transaction
+TEST_CASE( "ureact::transaction_group (throwing callback)" )
+{
+    ureact::context ctx_a;
+    ureact::context ctx_b;
+
+    auto a = ureact::make_var( ctx_a, 1 );
+    auto b = ureact::make_var( ctx_b, 10 );
+
+    ureact::observer obs_a = ureact::observe( a, []( int value ) {
+        if( value < 0 )
+            throw std::runtime_error( "negative value" );
+    } );
+
+    {
+        ureact::transaction_group group{ ctx_a, ctx_b };
+        a <<= -1;
+        b <<= 20;
+        CHECK_THROWS_AS( group.finish(), std::runtime_error );
+    }
+
+    CHECK( b.get() == 20 );
+
+    // Both contexts have left the transaction
+    a <<= 2;
+    b <<= 30;
+    CHECK( a.get() == 2 );
+    CHECK( b.get() == 30 );
+}
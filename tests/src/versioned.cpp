@@ -0,0 +1,61 @@
+//
+//         Copyright (C) 2020-2023 Krylov Yaroslav.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "ureact/utility/versioned.hpp"
+
+#include <map>
+#include <string>
+
+#include "catch2_extra.hpp"
+#include "ureact/adaptor/lift.hpp"
+#include "ureact/detail/has_changed.hpp"
+
+TEST_CASE( "ureact::versioned" )
+{
+    using book_t = std::map<int, std::string>;
+
+    SECTION( "Only version stamps are compared" )
+    {
+        using ureact::detail::has_changed;
+
+        const auto a = ureact::make_versioned( book_t{ { 1, "one" } }, 5 );
+        const auto b = ureact::make_versioned( book_t{ { 2, "two" } }, 5 );
+        auto c = a;
+        c.modify( []( book_t& book ) { book[3] = "three"; } );
+
+        CHECK_FALSE( has_changed( a, b ) );
+        CHECK( has_changed( a, c ) );
+        CHECK( c.version() == 6 );
+        CHECK( c->size() == 2 );
+    }
+
+    SECTION( "Consumers are not recalculated if stamp is the same" )
+    {
+        ureact::context ctx;
+
+        auto book = ureact::make_var( ctx, ureact::versioned<book_t>{} );
+
+        int calls = 0;
+        const auto size = ureact::lift( book, [&]( const ureact::versioned<book_t>& value ) {
+            ++calls;
+            return value->size();
+        } );
+
+        CHECK( calls == 1 );
+
+        auto next = book.get();
+        next.set( book_t{ { 1, "one" } } );
+        book <<= next;
+
+        CHECK( size.get() == 1 );
+        CHECK( calls == 2 );
+
+        // same stamp, so it is considered unchanged
+        book <<= next;
+        CHECK( calls == 2 );
+    }
+}